@@ -0,0 +1,159 @@
+/**
+ * @file bench_approche.cpp
+ * @brief Recherche approchée : index des trigrammes contre distance d'édition sur chaque livre.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Sur un catalogue réaliste (titres et auteurs seulement, pour tenir en mémoire), des mots
+ * pris dans des livres sont mal orthographiés (lettre oubliée, inversée, remplacée, accent
+ * ajouté), puis cherchés :
+ *  - index    : rechercherApproche, temps moyen par requête (objectif : moins de 10 ms
+ *               à 5 millions de livres, en version optimisée) ;
+ *  - parcours : la distance d'édition calculée pour chaque mot de chaque livre, une fois,
+ *               pour vérifier que l'index retrouve les mêmes livres (rappel = 1).
+ * Le livre d'où vient le mot doit toujours être trouvé.
+ *
+ * Usage : ./build/bench_approche [nombre_de_livres]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "index_approche.hpp"
+#include "utils.hpp"
+#include "bench_commun.hpp"
+
+// Titre et auteurs d'un livre réaliste (mêmes mots que genererLivreRealiste, sans le reste)
+static void titreEtAuteurs(std::uint64_t i, std::string& titre, std::string& auteurs) {
+    Hasard h = hasardDuLivre(i);
+    titre = phrase(h, 1 + h.inegal(5));
+    if (h.suivant() % 10 == 0) titre += " : " + phrase(h, h.entre(3, 15));
+    auteurs.clear();
+    std::uint64_t nbAuteurs = 1 + h.inegal(4);
+    for (std::uint64_t a = 0; a < nbAuteurs; a++) {
+        if (a > 0) auteurs += ", ";
+        auteurs += phrase(h, 1) + " " + phrase(h, 1);
+    }
+}
+
+// Le plus long mot (normalisé) d'un texte
+static std::string plusLongMot(const std::string& texte) {
+    std::istringstream flux(normaliserTexte(texte));
+    std::string mot, meilleur;
+    while (flux >> mot) {
+        if (mot.size() > meilleur.size()) meilleur = mot;
+    }
+    return meilleur;
+}
+
+// Une faute de frappe, différente selon 'sorte'
+static std::string avecFaute(std::string mot, int sorte) {
+    std::size_t milieu = mot.size() / 2;
+    switch (sorte % 4) {
+        case 0: mot.erase(milieu, 1); break;                          // Lettre oubliée
+        case 1: std::swap(mot[milieu - 1], mot[milieu]); break;       // Lettres inversées
+        case 2: mot[milieu] = (mot[milieu] == 'z') ? 'y' : 'z'; break; // Lettre remplacée
+        default: mot.insert(milieu, "\xC3\xA9"); break;               // "é" en trop (devient "e")
+    }
+    return mot;
+}
+
+// Référence : le mot est-il à moins de 'fautes' d'un mot du texte ?
+static bool procheDansTexte(const std::string& texte, const std::string& mot, int fautes) {
+    std::istringstream flux(normaliserTexte(texte));
+    std::string m;
+    while (flux >> m) {
+        if (distanceEdition(mot, m, fautes) <= fautes) return true;
+    }
+    return false;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 5000000;
+
+    CatalogueCompact livres;
+    reserverCatalogue(livres, nombre);
+    std::string titre, auteurs;
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        titreEtAuteurs(i, titre, auteurs);
+        LivreVue vue;
+        vue.title = titre;
+        vue.authors = auteurs;
+        ajouterAuCatalogue(livres, vue);
+    }
+
+    Chrono chronoIndex;
+    IndexApproche index;
+    construireIndexApproche(index, livres);
+    double construction = chronoIndex.secondes();
+    std::size_t trigrammes = 0;
+    for (const auto& t : index.trigrammes) trigrammes += t.second.size();
+    std::cout << "construction de l'index : " << construction << " s pour " << nombre << " livres, "
+              << index.mots.size() << " mots, " << index.trigrammes.size() << " trigrammes ("
+              << trigrammes << " entrées)" << std::endl;
+
+    // Requêtes : le plus long mot du titre ou des auteurs de quelques livres, avec une faute
+    struct Requete {
+        std::string texte;
+        std::uint32_t livre; // Livre d'où vient le mot (doit être trouvé)
+    };
+    std::vector<Requete> requetes;
+    for (int k = 0; k < 8; k++) {
+        std::uint32_t livre = static_cast<std::uint32_t>((static_cast<std::uint64_t>(k) * 2654435761ULL + 17) % nombre);
+        LivreVue vue = livres[livre];
+        std::string mot = plusLongMot(std::string(k % 2 ? vue.authors : vue.title));
+        if (mot.size() < 4) continue;
+        requetes.push_back({avecFaute(mot, k), livre});
+    }
+    // Deux mots : un du titre et un des auteurs, chacun avec une faute
+    {
+        std::uint32_t livre = static_cast<std::uint32_t>(nombre / 3);
+        LivreVue vue = livres[livre];
+        std::string motTitre = plusLongMot(std::string(vue.title)), motAuteur = plusLongMot(std::string(vue.authors));
+        if (motTitre.size() >= 4 && motAuteur.size() >= 4) requetes.push_back({avecFaute(motTitre, 0) + " " + avecFaute(motAuteur, 2), livre});
+    }
+
+    const int repetitions = 20;
+    std::cout << "requete;resultats;index_ms;parcours_ms;rappel;livre_source_trouve" << std::endl;
+    bool correct = true;
+    for (const Requete& r : requetes) {
+        std::vector<std::uint32_t> trouves;
+        Chrono chrono;
+        for (int i = 0; i < repetitions; i++) trouves = rechercherApproche(index, r.texte);
+        double ms = chrono.secondes() * 1000 / repetitions;
+
+        // Parcours complet (une seule fois) : chaque mot de la requête doit être proche d'un mot du livre
+        std::vector<std::string> mots;
+        std::istringstream flux(normaliserTexte(r.texte));
+        for (std::string m; flux >> m;) mots.push_back(m);
+        std::vector<std::uint32_t> attendus;
+        Chrono chronoParcours;
+        for (std::size_t i = 0; i < livres.size(); i++) {
+            LivreVue vue = livres[i];
+            std::string texte = std::string(vue.title) + " " + std::string(vue.authors);
+            bool tous = true;
+            for (const std::string& m : mots) tous = tous && procheDansTexte(texte, m, fautesTolerees(m.size()));
+            if (tous) attendus.push_back(static_cast<std::uint32_t>(i));
+        }
+        double parcours = chronoParcours.secondes() * 1000;
+
+        std::vector<std::uint32_t> tries = trouves;
+        std::sort(tries.begin(), tries.end());
+        std::vector<std::uint32_t> communs;
+        std::set_intersection(tries.begin(), tries.end(), attendus.begin(), attendus.end(), std::back_inserter(communs));
+        double rappel = attendus.empty() ? 1.0 : double(communs.size()) / double(attendus.size());
+        bool source = std::binary_search(tries.begin(), tries.end(), r.livre);
+        correct = correct && source && communs.size() == tries.size();
+
+        std::cout << r.texte << ";" << trouves.size() << ";" << ms << ";" << parcours << ";" << rappel << ";"
+                  << (source ? "oui" : "non") << std::endl;
+    }
+
+    if (!correct) {
+        std::cerr << "ERREUR : livre source absent, ou livre trouvé à tort !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
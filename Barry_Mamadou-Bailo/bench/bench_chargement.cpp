@@ -0,0 +1,80 @@
+/**
+ * @file bench_chargement.cpp
+ * @brief Compare le temps de démarrage entre le format texte et le format binaire.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Mesures sur le même catalogue :
+ *  - chargement du fichier texte (découpage ligne par ligne) ;
+ *  - chargement du fichier binaire dans une Library (projection, aucune copie) ;
+ *  - parcours de tous les titres après le chargement binaire (le système lit alors
+ *    vraiment les pages du fichier) ;
+ *  - premières recherches par ISBN après le chargement binaire (dans l'ordre rangé
+ *    dans le fichier, sans construire de table de hachage).
+ *
+ * Usage : ./build/bench_chargement [nombre_de_livres]
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 200000;
+    const std::string fichierTexte = "bench_library.db";
+    const std::string fichierBinaire = "bench_library.bin";
+
+    Library source;
+    initialiserBibliotheque(source);
+    for (std::uint64_t i = 0; i < nombre; i++) ajouterLivre(source, genererLivre(i));
+
+    sauvegarderInstantane(source, fichierTexte);
+    source.formatBinaire = true;
+    sauvegarderInstantane(source, fichierBinaire);
+
+    Library lib;
+    Chrono chronoTexte;
+    chargerBibliotheque(lib, fichierTexte);
+    double texte = chronoTexte.secondes();
+
+    // Le catalogue relu du texte, pour comparer
+    std::string dernierTexte(lib.books.back().description);
+    std::size_t nbTexte = lib.books.size();
+
+    Chrono chronoBinaire;
+    chargerBibliotheque(lib, fichierBinaire);
+    double binaire = chronoBinaire.secondes();
+
+    // Tous les titres : les pages du tas sont lues à ce moment-là
+    Chrono chronoParcours;
+    std::size_t totalTitres = 0;
+    for (const auto& livre : lib.books) totalTitres += livre.title.size();
+    double parcours = chronoParcours.secondes();
+
+    // 1000 recherches d'ISBN présents (recherche dichotomique dans l'ordre du fichier)
+    const int recherches = 1000;
+    bool trouves = true;
+    Chrono chronoIsbn;
+    for (int r = 0; r < recherches; r++) {
+        std::uint64_t i = (static_cast<std::uint64_t>(r) * 7919) % nombre;
+        trouves = trouves && trouverIsbn(lib, source.books[i].isbn) == static_cast<long>(i);
+    }
+    double isbn = chronoIsbn.secondes() * 1e6 / recherches;
+
+    std::cout << "livres;texte_s;binaire_s;parcours_titres_s;isbn_us" << std::endl;
+    std::cout << nombre << ";" << texte << ";" << binaire << ";" << parcours << ";" << isbn << std::endl;
+
+    // Petite vérification : les deux formats doivent donner le même catalogue
+    if (lib.books.size() != source.books.size() || nbTexte != source.books.size()
+        || lib.books.back().description != source.books.back().description
+        || dernierTexte != source.books.back().description || totalTitres == 0 || !trouves) {
+        std::cerr << "Erreur : le catalogue relu ne correspond pas !" << std::endl;
+        return 1;
+    }
+
+    std::remove(fichierTexte.c_str());
+    std::remove(fichierBinaire.c_str());
+    return 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file bench_commun.hpp
+ * @brief Outils partagés par les programmes de mesure de performance (bench/).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Fournit un chronomètre simple et deux générateurs de livres synthétiques
+ * déterministes (même numéro = même livre), pour que les mesures soient comparables :
+ *  - genererLivre : livres simples et réguliers (champs courts, toujours le 1er janvier) ;
+ *  - genererLivreRealiste : longueurs de champs variées comme dans un vrai catalogue
+ *    (quelques titres très longs, descriptions vides ou de plusieurs Ko, accents,
+ *    guillemets et ';' à protéger en CSV, genres et langues inégalement répartis).
+ */
+
+#ifndef BENCH_COMMUN_HPP
+#define BENCH_COMMUN_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "book.hpp"
+#include "csv.hpp" // Pour ecrireChampCSV (fichiers CSV réalistes)
+
+// Chronomètre : démarre à la construction, 'secondes()' donne le temps écoulé.
+struct Chrono {
+    std::chrono::steady_clock::time_point debut = std::chrono::steady_clock::now();
+
+    double secondes() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+    }
+};
+
+// Génère le livre numéro 'i'. Le résultat ne dépend que de 'i' (pas d'aléatoire caché),
+// ce qui permet de régénérer exactement le même catalogue à chaque lancement.
+inline Book genererLivre(std::uint64_t i) {
+    // Petit mélange de bits pour varier les champs sans dépendre de <random>
+    std::uint64_t h = i * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 29;
+
+    static const char* genres[] = {"Roman", "SF", "Policier", "Poésie", "Essai", "Théâtre"};
+    static const char* langues[] = {"FR", "EN", "ES", "DE"};
+
+    Book b;
+    b.isbn = "978-2-" + std::to_string(i);
+    b.title = "Titre numero " + std::to_string(h % 1000003) + " du livre " + std::to_string(i);
+    b.language = langues[h % 4];
+    b.authors = "Auteur " + std::to_string(h % 50021);
+    b.date = "01/01/" + std::to_string(1900 + h % 125);
+    b.genre = genres[(h >> 8) % 6];
+    b.description = "Description synthetique du livre " + std::to_string(i);
+    return b;
+}
+
+// Écrit un fichier CSV (avec en-tête) contenant les livres numérotés de 'premier' à 'premier + nombre - 1'.
+inline void ecrireCSV(const std::string& chemin, std::uint64_t premier, std::uint64_t nombre) {
+    std::ofstream f(chemin);
+    f << "ISBN;Titre;Langue;Auteurs;Date;Genre;Description\n";
+    for (std::uint64_t i = premier; i < premier + nombre; i++) {
+        Book b = genererLivre(i);
+        f << b.isbn << ';' << b.title << ';' << b.language << ';' << b.authors << ';'
+          << b.date << ';' << b.genre << ';' << b.description << '\n';
+    }
+}
+
+// --- CATALOGUE RÉALISTE ---
+
+// Suite pseudo-aléatoire (splitmix64) : entièrement déterminée par sa graine
+struct Hasard {
+    std::uint64_t etat;
+
+    std::uint64_t suivant() {
+        std::uint64_t z = (etat += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    // Entier entre 'min' et 'max' inclus
+    std::uint64_t entre(std::uint64_t min, std::uint64_t max) { return min + suivant() % (max - min + 1); }
+    // Réel entre 0 et 1
+    double reel() { return static_cast<double>(suivant() >> 11) / 9007199254740992.0; }
+    // Position entre 0 et n-1, les premières beaucoup plus souvent (comme les genres d'une vraie bibliothèque)
+    std::size_t inegal(std::size_t n) { double r = reel(); return static_cast<std::size_t>(r * r * r * static_cast<double>(n)); }
+};
+
+// Un mot de 1 à 4 syllabes (quelques syllabes accentuées, en UTF-8)
+inline void ajouterMot(std::string& texte, Hasard& h) {
+    static const char* syllabes[] = {"la", "ri", "mon", "é", "tra", "ver", "so", "lu", "min", "char", "beau", "deu",
+                                     "pré", "na", "ti", "que", "gar", "do", "mè", "ro", "cou", "ran", "ble", "fê",
+                                     "pa", "il", "nu", "sto", "zé", "vi", "an", "or"};
+    std::uint64_t nombre = 1 + h.inegal(4);
+    for (std::uint64_t s = 0; s < nombre; s++) texte += syllabes[h.suivant() % 32];
+}
+
+// 'nombre' mots séparés par des espaces, avec une majuscule au début
+inline std::string phrase(Hasard& h, std::uint64_t nombre) {
+    std::string texte;
+    for (std::uint64_t m = 0; m < nombre; m++) {
+        if (m > 0) texte += ' ';
+        ajouterMot(texte, h);
+    }
+    if (!texte.empty() && texte[0] >= 'a' && texte[0] <= 'z') texte[0] = static_cast<char>(texte[0] - 'a' + 'A');
+    return texte;
+}
+
+// ISBN-13 unique pour chaque 'i' (< 10^9), avec tirets et clé de contrôle valide
+inline std::string isbnRealiste(std::uint64_t i, Hasard& h) {
+    char chiffres[13];
+    chiffres[0] = '9'; chiffres[1] = '7'; chiffres[2] = '8';
+    for (int c = 11; c >= 3; c--) { chiffres[c] = static_cast<char>('0' + i % 10); i /= 10; }
+    int somme = 0;
+    for (int c = 0; c < 12; c++) somme += (chiffres[c] - '0') * (c % 2 ? 3 : 1);
+    chiffres[12] = static_cast<char>('0' + (10 - somme % 10) % 10);
+
+    // Groupe (1 chiffre), éditeur (2 à 6 chiffres), titre (le reste), clé
+    std::size_t editeur = 2 + static_cast<std::size_t>(h.suivant() % 5);
+    std::string isbn(chiffres, 3);
+    isbn += '-'; isbn += chiffres[3];
+    isbn += '-'; isbn.append(chiffres + 4, editeur);
+    isbn += '-'; isbn.append(chiffres + 4 + editeur, 8 - editeur);
+    isbn += '-'; isbn += chiffres[12];
+    return isbn;
+}
+
+// Suite pseudo-aléatoire propre au livre numéro 'i'
+inline Hasard hasardDuLivre(std::uint64_t i) { return Hasard{i * 0x2545F4914F6CDD1DULL + 1}; }
+
+// ISBN du livre réaliste numéro 'i', sans générer le reste du livre
+inline std::string isbnDuLivreRealiste(std::uint64_t i) {
+    Hasard h = hasardDuLivre(i);
+    return isbnRealiste(i, h);
+}
+
+// Génère le livre numéro 'i' d'un catalogue réaliste (même 'i' = même livre)
+inline Book genererLivreRealiste(std::uint64_t i) {
+    static const char* genres[] = {"Roman", "Policier", "Science-fiction", "Jeunesse", "Bande dessinée", "Essai",
+                                   "Biographie", "Histoire", "Poésie", "Théâtre", "Fantasy", "Cuisine", "Voyage",
+                                   "Sciences", "Philosophie", "Art", "Religion", "Droit", "Informatique", "Manga"};
+    static const char* langues[] = {"FR", "EN", "ES", "DE", "IT", "PT", "NL", "JA", "AR", "RU", "ZH", "PL"};
+    Hasard h = hasardDuLivre(i);
+
+    Book b;
+    b.isbn = isbnRealiste(i, h);
+
+    // Titre : 1 à 4 mots le plus souvent, parfois un long sous-titre (jusqu'à ~20 mots)
+    b.title = phrase(h, 1 + h.inegal(5));
+    if (h.suivant() % 10 == 0) b.title += " : " + phrase(h, h.entre(3, 15));
+    if (h.suivant() % 100 == 0) b.title = "\"" + b.title + "\"; tome " + std::to_string(h.entre(1, 12)); // À protéger en CSV
+
+    b.language = langues[h.inegal(12)];
+
+    // Auteurs : un seul le plus souvent, parfois plusieurs (séparés par des virgules)
+    std::uint64_t nbAuteurs = 1 + h.inegal(4);
+    for (std::uint64_t a = 0; a < nbAuteurs; a++) {
+        if (a > 0) b.authors += ", ";
+        b.authors += phrase(h, 1) + " " + phrase(h, 1);
+    }
+
+    // Dates de 1800 à 2025, les livres récents étant les plus nombreux
+    std::uint64_t annee = 2025 - h.inegal(226);
+    std::uint64_t mois = h.entre(1, 12), jour = h.entre(1, 28);
+    b.date = (jour < 10 ? "0" : "") + std::to_string(jour) + "/" + (mois < 10 ? "0" : "") + std::to_string(mois) + "/" + std::to_string(annee);
+
+    b.genre = genres[h.inegal(20)];
+
+    // Description : vide pour 1 livre sur 10, sinon de quelques mots à plusieurs Ko
+    if (h.suivant() % 10 != 0) {
+        std::uint64_t nbMots = h.entre(5, 30);
+        if (h.suivant() % 5 == 0) nbMots += h.inegal(600);
+        b.description = phrase(h, nbMots) + ".";
+    }
+    return b;
+}
+
+// Écrit un fichier CSV (avec en-tête) des livres réalistes numérotés de 0 à 'nombre' - 1.
+// Retourne la taille du fichier en octets.
+inline std::uint64_t ecrireCSVRealiste(const std::string& chemin, std::uint64_t nombre) {
+    std::ofstream f(chemin, std::ios::binary);
+    f << "ISBN;Titre;Langue;Auteurs;Date;Genre;Description\n";
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        Book b = genererLivreRealiste(i);
+        ecrireChampCSV(f, b.isbn); f << ';';
+        ecrireChampCSV(f, b.title); f << ';';
+        ecrireChampCSV(f, b.language); f << ';';
+        ecrireChampCSV(f, b.authors); f << ';';
+        ecrireChampCSV(f, b.date); f << ';';
+        ecrireChampCSV(f, b.genre); f << ';';
+        ecrireChampCSV(f, b.description); f << '\n';
+    }
+    return static_cast<std::uint64_t>(f.tellp());
+}
+
+#endif // BENCH_COMMUN_HPP
@@ -0,0 +1,85 @@
+/**
+ * @file bench_csv.cpp
+ * @brief Compare l'ancien découpage (istringstream + std::string) au lecteur CSV sans allocation.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Génère un fichier CSV de la taille demandée, puis le découpe avec les deux méthodes
+ * en comptant les champs (les deux comptes doivent être identiques).
+ *
+ * Usage : ./build/bench_csv [taille_en_Mo]   (ex: 1024 pour 1 Go)
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "csv.hpp"
+#include "bench_commun.hpp"
+
+// Ancienne version de splitLigne (copiée telle quelle pour la comparaison)
+static std::vector<std::string> ancienSplitLigne(const std::string& s, char delimiter) {
+    std::vector<std::string> tokens;
+    std::string token;
+    std::istringstream tokenStream(s);
+    while (std::getline(tokenStream, token, delimiter)) {
+        tokens.push_back(token);
+    }
+    if (!s.empty() && s.back() == delimiter) {
+        tokens.push_back("");
+    }
+    return tokens;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t tailleMo = (argc > 1) ? std::stoull(argv[1]) : 64;
+    const std::string chemin = "bench_csv.csv";
+
+    // 1. Génération du fichier (environ 'tailleMo' mégaoctets)
+    {
+        std::ofstream f(chemin);
+        std::uint64_t ecrit = 0;
+        for (std::uint64_t i = 0; ecrit < tailleMo * 1024 * 1024; i++) {
+            Book b = genererLivre(i);
+            std::string ligne = b.isbn + ";" + b.title + ";" + b.language + ";" + b.authors + ";"
+                              + b.date + ";" + b.genre + ";\"" + b.description + " ; avec \"\"guillemets\"\"\"\n";
+            f << ligne;
+            ecrit += ligne.size();
+        }
+    }
+
+    // 2. Ancienne méthode : getline + splitLigne
+    std::size_t champsAncien = 0;
+    Chrono chronoAncien;
+    {
+        std::ifstream f(chemin);
+        std::string ligne;
+        while (std::getline(f, ligne)) champsAncien += ancienSplitLigne(ligne, ';').size();
+    }
+    double ancien = chronoAncien.secondes();
+
+    // 3. Nouvelle méthode : lecteur par blocs + vues
+    std::size_t champsNouveau = 0;
+    Chrono chronoNouveau;
+    {
+        std::ifstream f(chemin, std::ios::binary);
+        LecteurCSV lecteur;
+        ouvrirLecteurCSV(lecteur, f, ';');
+        std::vector<std::string_view> champs;
+        while (lireEnregistrement(lecteur, champs)) champsNouveau += champs.size();
+    }
+    double nouveau = chronoNouveau.secondes();
+
+    double mo = static_cast<double>(tailleMo);
+    std::cout << "taille_Mo;ancien_s;ancien_Mo_s;nouveau_s;nouveau_Mo_s;acceleration" << std::endl;
+    std::cout << tailleMo << ";" << ancien << ";" << mo / ancien << ";"
+              << nouveau << ";" << mo / nouveau << ";" << ancien / nouveau << std::endl;
+
+    // L'ancien découpage coupe aussi sur les ';' entre guillemets : il trouve une colonne de plus par ligne
+    std::cout << "champs (ancien / nouveau) : " << champsAncien << " / " << champsNouveau << std::endl;
+
+    std::remove(chemin.c_str());
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file bench_curseur.cpp
+ * @brief Recherche par titre : temps avant la première page, avec et sans curseur.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Le même catalogue est mesuré à deux tailles (il grandit entre les deux mesures) :
+ *  - premiere_page : le curseur cherche juste de quoi remplir une page (+ 1 livre) ;
+ *  - tout          : le parcours complet, comme avant le curseur.
+ * Le temps de la première page ne doit pas grandir avec le catalogue, celui du parcours
+ * complet si. On vérifie aussi que le curseur, poussé jusqu'au bout, trouve les mêmes livres.
+ *
+ * Pour tenir en mémoire avec 10 millions de livres, seul le titre est gardé.
+ *
+ * Usage : ./build/bench_curseur [nombre_de_livres]
+ */
+
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "utils.hpp"
+#include "bench_commun.hpp"
+
+static void ajouterTitres(Library& lib, std::uint64_t premier, std::uint64_t dernier) {
+    for (std::uint64_t i = premier; i < dernier; i++) {
+        Book b = genererLivre(i);
+        LivreVue vue;
+        vue.title = b.title;
+        ajouterAuCatalogue(lib.books, vue); // Sans index ISBN : seul le titre sert ici
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 10000000;
+    const std::size_t livresParPage = 10;
+    const std::vector<std::string> recherches = {"titre", "du livre 7"};
+
+    Library lib;
+    initialiserBibliotheque(lib);
+    reserverCatalogue(lib.books, nombre);
+
+    std::cout << "recherche;livres;trouves;premiere_page_ms;tout_s" << std::endl;
+    bool correct = true;
+    std::uint64_t dejaAjoutes = 0;
+    for (std::uint64_t taille : {nombre / 10, nombre}) {
+        ajouterTitres(lib, dejaAjoutes, taille);
+        dejaAjoutes = taille;
+
+        for (const auto& recherche : recherches) {
+            CurseurRecherche premiere = rechercherTitre(lib, recherche);
+            Chrono chronoPage;
+            std::size_t page = avancerCurseur(premiere, livresParPage + 1);
+            double premierePage = chronoPage.secondes();
+
+            CurseurRecherche complete = rechercherTitre(lib, recherche);
+            Chrono chronoTout;
+            std::size_t total = avancerCurseur(complete, std::numeric_limits<std::size_t>::max());
+            double tout = chronoTout.secondes();
+
+            std::cout << '"' << recherche << "\";" << taille << ";" << total << ";" << premierePage * 1000 << ";" << tout << std::endl;
+
+            // Le curseur repris là où il s'était arrêté doit finir avec les mêmes livres
+            avancerCurseur(premiere, std::numeric_limits<std::size_t>::max());
+            correct = correct && page == std::min<std::size_t>(total, livresParPage + 1)
+                      && curseurTermine(premiere) && premiere.trouves == complete.trouves;
+        }
+    }
+
+    if (!correct) {
+        std::cerr << "ERREUR : le curseur ne trouve pas les mêmes livres que le parcours complet !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file bench_dates.cpp
+ * @brief Décodage des dates et recherche "publiés entre X et Y" : avant / après.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * 1. Décodage : l'ancienne validation (3 substr + 3 std::stoi + try/catch) contre
+ *    dateCompacte (sans allocation, presque sans saut). On vérifie d'abord que les deux
+ *    donnent la même réponse sur toutes les dates de 1000 à 3000, y compris les fausses.
+ * 2. Intervalle de dates : parcours de tout le catalogue contre l'index trié (deux
+ *    recherches dichotomiques), sur plusieurs largeurs d'intervalle.
+ *
+ * Usage : ./build/bench_dates [nombre_de_livres]
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "utils.hpp"
+#include "bench_commun.hpp"
+
+// Ancienne version de estDateValide (avant l'entier AAAAMMJJ), gardée comme référence
+static bool ancienneValidation(const std::string& date) {
+    if (date.length() != 10) return false;
+    if (date[2] != '/' || date[5] != '/') return false;
+    try {
+        std::string jourStr = date.substr(0, 2);
+        std::string moisStr = date.substr(3, 2);
+        std::string anneeStr = date.substr(6, 4);
+        for (char c : jourStr) if (!isdigit(c)) return false;
+        for (char c : moisStr) if (!isdigit(c)) return false;
+        for (char c : anneeStr) if (!isdigit(c)) return false;
+        int jour = std::stoi(jourStr);
+        int mois = std::stoi(moisStr);
+        int annee = std::stoi(anneeStr);
+        if (annee < 1000 || annee > 3000) return false;
+        if (mois < 1 || mois > 12) return false;
+        int joursDansMois[] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if ((annee % 4 == 0 && annee % 100 != 0) || (annee % 400 == 0)) joursDansMois[2] = 29;
+        if (jour < 1 || jour > joursDansMois[mois]) return false;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+// Toutes les combinaisons jour 00-39 / mois 00-19 / année 0990-3010, plus quelques textes abîmés
+static std::vector<std::string> datesDeTest() {
+    std::vector<std::string> dates;
+    char texte[16];
+    for (int annee = 990; annee <= 3010; annee++) {
+        for (int mois = 0; mois < 20; mois++) {
+            for (int jour = 0; jour < 40; jour++) {
+                std::snprintf(texte, sizeof(texte), "%02d/%02d/%04d", jour, mois, annee);
+                dates.push_back(texte);
+            }
+        }
+    }
+    for (const char* faux : {"", "1/1/2000", "01-01-2000", "0a/01/2000", "01/01/20x0", "01/01/200",
+                             "01/01/20000", "  /01/2000", "01/ 1/2000", "+1/01/2000", "29/02/1900", "29/02/2000"}) {
+        dates.push_back(faux);
+    }
+    return dates;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 2000000;
+    bool correct = true;
+
+    // --- 1. Décodage ---
+    std::vector<std::string> dates = datesDeTest();
+    std::size_t valides = 0;
+    Chrono chronoAncien;
+    for (const auto& d : dates) valides += ancienneValidation(d);
+    double ancien = chronoAncien.secondes();
+
+    std::size_t validesNouveau = 0;
+    Chrono chronoNouveau;
+    for (const auto& d : dates) validesNouveau += (dateCompacte(d) != 0);
+    double nouveau = chronoNouveau.secondes();
+
+    for (const auto& d : dates) {
+        std::uint32_t date = dateCompacte(d);
+        bool attendu = ancienneValidation(d);
+        if ((date != 0) != attendu) {
+            std::cerr << "Désaccord sur \"" << d << "\"" << std::endl;
+            correct = false;
+        }
+        // L'entier doit bien être AAAAMMJJ
+        if (date != 0 && date != static_cast<std::uint32_t>(std::stoi(d.substr(6, 4)) * 10000 + std::stoi(d.substr(3, 2)) * 100 + std::stoi(d.substr(0, 2)))) {
+            correct = false;
+        }
+    }
+
+    std::cout << "decodage;dates;valides;ancien_ns;nouveau_ns;acceleration" << std::endl;
+    std::cout << "dates;" << dates.size() << ";" << valides << ";" << ancien * 1e9 / dates.size() << ";"
+              << nouveau * 1e9 / dates.size() << ";" << ancien / nouveau << std::endl;
+    correct = correct && valides == validesNouveau;
+
+    // --- 2. Livres publiés entre deux dates ---
+    Library lib;
+    initialiserBibliotheque(lib);
+    reserverCatalogue(lib.books, nombre);
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        Book b = genererLivre(i);
+        // Jour et mois variés (genererLivre met toujours le 1er janvier)
+        char date[16];
+        std::snprintf(date, sizeof(date), "%02d/%02d/%s", static_cast<int>(1 + i % 28), static_cast<int>(1 + (i / 28) % 12), b.date.c_str() + 6);
+        b.date = date;
+        ajouterLivre(lib, b);
+    }
+
+    Chrono chronoIndex;
+    livresEntreDates(lib, 0, 0xFFFFFFFF); // Première question : construction de l'index
+    double construction = chronoIndex.secondes();
+
+    std::cout << "intervalle;livres;trouves;parcours_s;index_s;acceleration (construction index : "
+              << construction << " s)" << std::endl;
+
+    struct Intervalle { const char* nom; std::uint32_t min, max; };
+    const Intervalle intervalles[] = {
+        {"un_jour", 19840714, 19840714},
+        {"un_mois", 19840701, 19840731},
+        {"un_an", 19840101, 19841231},
+        {"vingt_ans", 19500101, 19691231},
+    };
+    for (const auto& inter : intervalles) {
+        Chrono chronoParcours;
+        std::vector<std::uint32_t> parParcours;
+        for (std::size_t i = 0; i < lib.books.size(); i++) {
+            std::uint32_t d = lib.books.livres[i].date;
+            if (d >= inter.min && d <= inter.max) parParcours.push_back(static_cast<std::uint32_t>(i));
+        }
+        double parcours = chronoParcours.secondes();
+
+        Chrono chronoRecherche;
+        TrancheDates tranche = livresEntreDates(lib, inter.min, inter.max);
+        double recherche = chronoRecherche.secondes();
+
+        // Mêmes livres, et bien dans l'ordre des dates
+        std::vector<std::uint32_t> parIndex;
+        for (const EntreeDate* e = tranche.debut; e != tranche.fin; e++) {
+            if (e != tranche.debut && (e - 1)->date > e->date) correct = false;
+            parIndex.push_back(e->livre);
+        }
+        std::sort(parIndex.begin(), parIndex.end());
+        correct = correct && parIndex == parParcours;
+
+        std::cout << inter.nom << ";" << nombre << ";" << tranche.size() << ";" << parcours << ";"
+                  << recherche << ";" << parcours / recherche << std::endl;
+    }
+
+    // Un ajout après construction doit être trouvé à la question suivante
+    Book ajout = genererLivre(nombre);
+    ajout.date = "14/07/1789";
+    ajouterLivre(lib, ajout);
+    TrancheDates revolution = livresEntreDates(lib, 17890714, 17890714);
+    correct = correct && revolution.size() == 1 && revolution.debut->livre == lib.books.size() - 1;
+
+    if (!correct) {
+        std::cerr << "ERREUR : dates ou index des dates incorrects !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
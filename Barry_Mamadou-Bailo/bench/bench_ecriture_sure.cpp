@@ -0,0 +1,100 @@
+/**
+ * @file bench_ecriture_sure.cpp
+ * @brief Coût de l'écriture sûre du catalogue (fichier temporaire + somme + fsync + renommage).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Compare l'ancienne écriture (ofstream ouvert directement sur la cible, sans somme ni
+ * fsync) à ecrireInstantane, sur le même catalogue. Vérifie ensuite qu'un fichier dont
+ * un octet a changé, ou qui a été tronqué, est bien refusé au chargement.
+ *
+ * Usage : ./build/bench_ecriture_sure [nombre_de_livres]
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "library.hpp"
+#include "csv.hpp"
+#include "bench_commun.hpp"
+
+// Ancienne version : la cible est vidée dès l'ouverture, puis écrite ligne par ligne
+static bool ancienneEcriture(const Library& lib, const std::string& fichierDb) {
+    std::ofstream fichier(fichierDb);
+    if (!fichier) return false;
+    fichier << lib.name << '\n' << lib.description << '\n';
+    for (const auto& livre : lib.books) {
+        ecrireChampCSV(fichier, livre.isbn); fichier << ';';
+        ecrireChampCSV(fichier, livre.title); fichier << ';';
+        ecrireChampCSV(fichier, livre.language); fichier << ';';
+        ecrireChampCSV(fichier, livre.authors); fichier << ';';
+        ecrireChampCSV(fichier, livre.date); fichier << ';';
+        ecrireChampCSV(fichier, livre.genre); fichier << ';';
+        ecrireChampCSV(fichier, livre.description); fichier << '\n';
+    }
+    return static_cast<bool>(fichier);
+}
+
+// Modifie un octet au milieu du fichier
+static void abimer(const std::string& fichierDb) {
+    std::fstream f(fichierDb, std::ios::in | std::ios::out | std::ios::binary);
+    std::streamoff milieu = static_cast<std::streamoff>(std::filesystem::file_size(fichierDb) / 2);
+    char c = 0;
+    f.seekg(milieu);
+    f.get(c);
+    f.seekp(milieu);
+    f.put(static_cast<char>(c ^ 0x20));
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 500000;
+    const std::string fichier = "bench_ecriture_sure.db";
+
+    Library lib;
+    initialiserBibliotheque(lib);
+    for (std::uint64_t i = 0; i < nombre; i++) ajouterLivre(lib, genererLivre(i));
+
+    Chrono chronoAncien;
+    ancienneEcriture(lib, fichier);
+    double ancien = chronoAncien.secondes();
+
+    Chrono chronoTexte;
+    bool texteOk = ecrireInstantane(lib, fichier);
+    double texte = chronoTexte.secondes();
+
+    // Le chargement vérifie la somme avant de lire les livres
+    Library relue;
+    Chrono chronoChargement;
+    ResultatChargement resultat = chargerInstantane(relue, fichier);
+    double chargement = chronoChargement.secondes();
+
+    lib.formatBinaire = true;
+    Chrono chronoBinaire;
+    bool binaireOk = ecrireInstantane(lib, fichier + ".bin");
+    double binaire = chronoBinaire.secondes();
+
+    std::cout << "livres;ancien_texte_s;sur_texte_s;surcout_pct;sur_binaire_s;chargement_texte_s" << std::endl;
+    std::cout << nombre << ";" << ancien << ";" << texte << ";" << (texte / ancien - 1) * 100 << ";"
+              << binaire << ";" << chargement << std::endl;
+
+    bool correct = texteOk && binaireOk && resultat == CHARGE_OK && relue.books.size() == lib.books.size();
+
+    // Fichiers abîmés : ils doivent être refusés, pas chargés à moitié
+    Library rejet;
+    abimer(fichier);
+    correct = correct && chargerInstantane(rejet, fichier) == CHARGE_CORROMPU;
+    abimer(fichier + ".bin");
+    correct = correct && chargerInstantane(rejet, fichier + ".bin") == CHARGE_CORROMPU;
+    std::filesystem::resize_file(fichier, std::filesystem::file_size(fichier) / 2);
+    correct = correct && chargerInstantane(rejet, fichier) == CHARGE_CORROMPU;
+
+    std::remove(fichier.c_str());
+    std::remove((fichier + ".bin").c_str());
+    if (!correct) {
+        std::cerr << "ERREUR : écriture ou détection de corruption incorrecte !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
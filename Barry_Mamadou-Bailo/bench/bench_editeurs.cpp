@@ -0,0 +1,106 @@
+/**
+ * @file bench_editeurs.cpp
+ * @brief Recherche par code éditeur : "-CODE-" dans chaque ISBN contre l'index des éditeurs.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Sur un catalogue d'ISBN réalistes (avec tirets, un sur quatre écrit sans tirets), compare :
+ *  - parcours : l'ancienne méthode, "-CODE-" cherché dans chaque ISBN ;
+ *  - index    : l'index des éditeurs (construit une fois, puis recherches dichotomiques).
+ * L'index doit trouver exactement les livres dont la 3e partie de l'ISBN (avec tirets) est
+ * le code cherché ; le parcours, lui, ne voit pas les ISBN sans tirets et prend aussi un
+ * groupe ou un numéro de publication égal au code.
+ *
+ * Pour tenir en mémoire avec beaucoup de livres, le catalogue ne garde que les ISBN.
+ *
+ * Usage : ./build/bench_editeurs [nombre_de_livres]
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+// Groupe et éditeur d'un ISBN réaliste avec tirets : 978-G-EDITEUR-PUBLICATION-CLE
+static std::string partieIsbn(const std::string& isbn, int numero) {
+    std::size_t debut = 0;
+    for (int i = 0; i < numero; i++) debut = isbn.find('-', debut) + 1;
+    return isbn.substr(debut, isbn.find('-', debut) - debut);
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 1000000;
+
+    CatalogueCompact livres;
+    reserverCatalogue(livres, nombre);
+    std::vector<std::string> groupes(nombre), editeurs(nombre); // Parties de chaque ISBN (pour vérifier)
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        std::string isbn = isbnDuLivreRealiste(i);
+        groupes[i] = partieIsbn(isbn, 1);
+        editeurs[i] = partieIsbn(isbn, 2);
+        LivreVue vue;
+        // Sans tirets, le découpage suit la table des tranches : on ne l'utilise donc que
+        // si elle redonne le même éditeur que les tirets (le générateur tire les longueurs au hasard)
+        std::string sansTirets = normaliserIsbn(isbn);
+        StructureIsbn avec, sans;
+        bool memeDecoupage = decouperIsbn(isbn, avec) && decouperIsbn(sansTirets, sans)
+                             && avec.editeur == sans.editeur && avec.chiffresEditeur == sans.chiffresEditeur;
+        if (i % 4 == 3 && memeDecoupage) isbn = sansTirets;
+        vue.isbn = isbn;
+        ajouterAuCatalogue(livres, vue);
+    }
+
+    Chrono chronoIndex;
+    IndexEditeurs index;
+    preparerIndexEditeurs(index, livres);
+    double construction = chronoIndex.secondes();
+    std::cout << "construction de l'index : " << construction << " s pour " << nombre << " livres ("
+              << index.nonDecoupes.size() << " ISBN non découpés)" << std::endl;
+
+    // Éditeurs de quelques livres, seuls puis avec leur groupe, et un code absent
+    std::vector<std::string> codes;
+    for (std::uint64_t i : {std::uint64_t{1}, std::uint64_t{777} % nombre, nombre / 2, nombre - 1}) {
+        std::string isbn = isbnDuLivreRealiste(i);
+        codes.push_back(partieIsbn(isbn, 2));
+        codes.push_back(partieIsbn(isbn, 1) + "-" + partieIsbn(isbn, 2));
+    }
+    codes.push_back("9999999");
+
+    std::cout << "code;livres;parcours_trouves;index_trouves;parcours_s;index_s;acceleration" << std::endl;
+    bool correct = true;
+    for (const std::string& code : codes) {
+        // Ancienne méthode
+        std::string cherche = "-" + code + "-";
+        std::size_t trouvesParcours = 0;
+        Chrono chronoParcours;
+        for (std::size_t i = 0; i < livres.size(); i++) {
+            if (livres[i].isbn.find(cherche) != std::string_view::npos) trouvesParcours++;
+        }
+        double parcours = chronoParcours.secondes();
+
+        Chrono chronoRecherche;
+        std::vector<std::uint32_t> trouves = chercherEditeur(index, livres, code);
+        double recherche = chronoRecherche.secondes();
+
+        // Vérification : les livres de cet éditeur (et de ce groupe si demandé), dans l'ordre
+        std::vector<std::uint32_t> attendus;
+        std::size_t tiret = code.find('-');
+        for (std::uint64_t i = 0; i < nombre; i++) {
+            bool bonGroupe = tiret == std::string::npos || groupes[i] == code.substr(0, tiret);
+            if (bonGroupe && editeurs[i] == code.substr(tiret == std::string::npos ? 0 : tiret + 1)) {
+                attendus.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+        correct = correct && trouves == attendus;
+
+        std::cout << code << ";" << nombre << ";" << trouvesParcours << ";" << trouves.size() << ";"
+                  << parcours << ";" << recherche << ";" << parcours / recherche << std::endl;
+    }
+
+    if (!correct) {
+        std::cerr << "ERREUR : l'index ne trouve pas les livres de l'éditeur !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
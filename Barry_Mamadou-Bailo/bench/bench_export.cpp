@@ -0,0 +1,123 @@
+/**
+ * @file bench_export.cpp
+ * @brief Compare l'ancien export HTML (clé recalculée à chaque comparaison) au tri par clés précalculées.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Génère un catalogue synthétique, puis mesure l'export complet avec les deux méthodes.
+ * Les livres doivent sortir dans le même ordre (tous les titres du générateur sont distincts).
+ *
+ * Usage : ./build/bench_export [nombre_de_livres]   (ex: 1000000)
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+// Anciennes versions (copiées telles quelles pour la comparaison)
+static std::string ancienNettoyerTitrePourTri(std::string titre) {
+    std::string s = titre;
+    for (auto & c: s) c = toupper(c);
+    const std::vector<std::string> prefixes = {
+        "LE ", "LA ", "L'", "LES ", "UN ", "UNE ", "DES ",
+        "D'", "J'", "QU'", "S'"
+    };
+    for (const auto& p : prefixes) {
+        if (s.substr(0, p.size()) == p) {
+            return s.substr(p.size());
+        }
+    }
+    return s;
+}
+
+static bool ancienComparerLivres(const Book& a, const Book& b) {
+    return ancienNettoyerTitrePourTri(a.title) < ancienNettoyerTitrePourTri(b.title);
+}
+
+// Ancien export, réduit à ce qui coûte : copie, tri, puis deux passes qui recalculent la clé
+static void ancienExporterHTML(const Library& lib, const std::string& filename) {
+    std::vector<Book> livresTries;
+    livresTries.reserve(lib.books.size());
+    for (const auto& livre : lib.books) livresTries.push_back(copierLivre(livre));
+    std::sort(livresTries.begin(), livresTries.end(), ancienComparerLivres);
+
+    std::ofstream fichier(filename);
+    fichier << "<h1>" << lib.name << "</h1>" << std::endl;
+    std::string lettresPresentes = "";
+    for (const auto& livre : livresTries) {
+        std::string cle = ancienNettoyerTitrePourTri(livre.title);
+        char premiereLettre = cle[0];
+        if (!isalpha(premiereLettre)) premiereLettre = '#';
+        if (lettresPresentes.find(premiereLettre) == std::string::npos) lettresPresentes += premiereLettre;
+    }
+    char sectionActuelle = 0;
+    for (const auto& livre : livresTries) {
+        std::string cle = ancienNettoyerTitrePourTri(livre.title);
+        char lettre = cle[0];
+        if (!isalpha(lettre)) lettre = '#';
+        if (lettre != sectionActuelle) {
+            sectionActuelle = lettre;
+            fichier << "<h2 id='section-" << sectionActuelle << "'>" << sectionActuelle << "</h2>" << std::endl;
+        }
+        fichier << "<div class='livre-titre'>" << livre.title << "</div>" << std::endl;
+    }
+}
+
+// Extrait les lignes de titres d'un fichier HTML (pour vérifier que l'ordre est le même)
+static std::vector<std::string> lignesTitres(const std::string& chemin) {
+    std::ifstream f(chemin);
+    std::vector<std::string> titres;
+    std::string ligne;
+    while (std::getline(f, ligne)) {
+        if (ligne.find("livre-titre'>") == std::string::npos) continue;
+        // Le nouvel export échappe l'apostrophe (seul caractère spécial des titres générés)
+        for (std::size_t p = ligne.find("&#39;"); p != std::string::npos; p = ligne.find("&#39;", p + 1)) {
+            ligne.replace(p, 5, "'");
+        }
+        titres.push_back(ligne);
+    }
+    return titres;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nbLivres = (argc > 1) ? std::stoull(argv[1]) : 1000000;
+    const std::string cheminAncien = "bench_export_ancien.html";
+    const std::string cheminNouveau = "bench_export_nouveau.html";
+
+    // 1. Catalogue synthétique (quelques titres avec article pour exercer les préfixes)
+    Library lib;
+    lib.name = "Bench";
+    static const char* articles[] = {"", "Le ", "La ", "L'", "Les ", "Un "};
+    for (std::uint64_t i = 0; i < nbLivres; i++) {
+        Book b = genererLivre(i);
+        b.title = articles[i % 6] + b.title;
+        ajouterLivre(lib, std::move(b));
+    }
+
+    // 2. Mesures
+    Chrono chronoAncien;
+    ancienExporterHTML(lib, cheminAncien);
+    double ancien = chronoAncien.secondes();
+
+    Chrono chronoNouveau;
+    exporterHTML(lib, cheminNouveau);
+    double nouveau = chronoNouveau.secondes();
+
+    std::cout << "livres;ancien_s;nouveau_s;acceleration" << std::endl;
+    std::cout << nbLivres << ";" << ancien << ";" << nouveau << ";" << ancien / nouveau << std::endl;
+
+    bool identique = (lignesTitres(cheminAncien) == lignesTitres(cheminNouveau));
+    std::remove(cheminAncien.c_str());
+    std::remove(cheminNouveau.c_str());
+    if (!identique) {
+        std::cerr << "ERREUR : l'ordre des livres diffère entre les deux exports !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file bench_facettes.cpp
+ * @brief Parcours par facettes : comptes par genre / langue / décennie, parcours contre bitmaps.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Sur un catalogue réaliste (genres et langues inégalement répartis, dates de 1800 à 2025),
+ * pour quelques sélections, compare :
+ *  - parcours : un seul passage sur les livres (numéros de genre, de langue et date déjà
+ *               décodés), qui compte toutes les valeurs de la facette d'un coup ;
+ *  - bitmaps  : compterFacette (ET compté des bitmaps compressés, sans relire les livres).
+ * Les comptes doivent être identiques. Mesure aussi la liste des livres d'une sélection
+ * (livresSelection contre le filtre des colonnes, SSE2) et la mémoire de l'index.
+ *
+ * Pour tenir en mémoire avec 10 millions de livres, le catalogue ne garde que les champs
+ * des facettes.
+ *
+ * Usage : ./build/bench_facettes [nombre_de_livres]
+ */
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+// Une sélection de la mesure, en texte (-1 / 0 = pas de choix)
+struct CasFacette {
+    std::string nom;
+    Facette facette;                 // Facette comptée
+    std::string genre, langue;       // Vide = pas de choix
+    long decennie;                   // -1 = pas de choix
+};
+
+// Référence : un passage sur le catalogue, compte de chaque valeur de 'facette'
+static std::map<long, std::uint32_t> compterParcours(const CatalogueCompact& livres, const SelectionFacettes& s, Facette facette) {
+    std::map<long, std::uint32_t> comptes;
+    for (const LivreCompact& l : livres.livres) {
+        long valeurs[NB_FACETTES] = {static_cast<long>(l.genre), static_cast<long>(l.langue), decennieDe(l.date)};
+        bool garde = true;
+        for (int f = 0; f < NB_FACETTES; f++) {
+            if (f != facette && s.choix[f] >= 0 && valeurs[f] != s.choix[f]) garde = false;
+        }
+        if (garde) comptes[valeurs[facette]]++;
+    }
+    return comptes;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 10000000;
+
+    CatalogueCompact livres;
+    reserverCatalogue(livres, nombre);
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        Book b = genererLivreRealiste(i);
+        LivreVue vue;
+        vue.language = b.language;
+        vue.genre = b.genre;
+        vue.date = b.date;
+        ajouterAuCatalogue(livres, vue);
+    }
+
+    Chrono chronoIndex;
+    IndexFacettes index;
+    construireIndexFacettes(index, livres);
+    double construction = chronoIndex.secondes();
+    std::size_t octets = 0;
+    for (const auto& e : index.genres) octets += octetsBitmap(e);
+    for (const auto& e : index.langues) octets += octetsBitmap(e);
+    for (const auto& e : index.decennies) octets += octetsBitmap(e.second);
+    std::cout << "construction de l'index : " << construction << " s pour " << nombre << " livres, "
+              << octets / 1e6 << " Mo (" << double(octets) / nombre << " octets par livre)" << std::endl;
+
+    const std::vector<CasFacette> cas = {
+        {"genres", FACETTE_GENRE, "", "", -1},
+        {"genres|langue", FACETTE_GENRE, "", "EN", -1},
+        {"genres|langue+decennie", FACETTE_GENRE, "", "FR", 1990},
+        {"langues|genre+decennie", FACETTE_LANGUE, "Poésie", "", 1950},
+        {"decennies|genre+langue", FACETTE_DECENNIE, "Roman", "DE", -1},
+    };
+
+    std::cout << "cas;livres;valeurs;parcours_ms;bitmaps_ms;acceleration" << std::endl;
+    bool correct = true;
+    for (const auto& c : cas) {
+        SelectionFacettes selection;
+        if (!c.genre.empty()) selection.choix[FACETTE_GENRE] = livres.genres.numeros.at(c.genre);
+        if (!c.langue.empty()) selection.choix[FACETTE_LANGUE] = livres.langues.numeros.at(c.langue);
+        selection.choix[FACETTE_DECENNIE] = c.decennie;
+
+        Chrono chronoParcours;
+        std::map<long, std::uint32_t> attendus = compterParcours(livres, selection, c.facette);
+        double parcours = chronoParcours.secondes() * 1000;
+
+        const int repetitions = 10;
+        std::vector<CompteFacette> comptes;
+        Chrono chronoBitmaps;
+        for (int r = 0; r < repetitions; r++) comptes = compterFacette(index, selection, c.facette);
+        double bitmaps = chronoBitmaps.secondes() * 1000 / repetitions;
+
+        std::map<long, std::uint32_t> trouves;
+        for (const CompteFacette& compte : comptes) trouves[compte.valeur] = compte.livres;
+        correct = correct && trouves == attendus;
+
+        std::cout << c.nom << ";" << nombre << ";" << comptes.size() << ";" << parcours << ";" << bitmaps << ";"
+                  << parcours / bitmaps << std::endl;
+    }
+
+    // Liste des livres d'une sélection : ET des bitmaps contre le filtre des colonnes
+    SelectionFacettes selection;
+    selection.choix[FACETTE_GENRE] = livres.genres.numeros.at("Roman");
+    selection.choix[FACETTE_LANGUE] = livres.langues.numeros.at("FR");
+    selection.choix[FACETTE_DECENNIE] = 2010;
+    FiltreLivres filtre;
+    filtre.genre = selection.choix[FACETTE_GENRE];
+    filtre.langue = selection.choix[FACETTE_LANGUE];
+    filtrerAnnees(filtre, 2010, 2019);
+    ColonnesLivres colonnes;
+    construireColonnes(colonnes, livres);
+
+    Chrono chronoFiltre;
+    std::vector<std::uint32_t> parFiltre = filtrerColonnes(colonnes, filtre);
+    double tempsFiltre = chronoFiltre.secondes() * 1000;
+    Chrono chronoListe;
+    std::vector<std::uint32_t> parBitmaps = livresSelection(index, selection);
+    double tempsListe = chronoListe.secondes() * 1000;
+    correct = correct && parFiltre == parBitmaps;
+    std::cout << "liste Roman+FR+2010;" << nombre << ";" << parBitmaps.size() << ";" << tempsFiltre << ";" << tempsListe
+              << ";" << tempsFiltre / tempsListe << std::endl;
+
+    if (!correct) {
+        std::cerr << "ERREUR : les bitmaps ne donnent pas les mêmes comptes que le parcours !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
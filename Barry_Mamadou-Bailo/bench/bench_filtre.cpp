@@ -0,0 +1,112 @@
+/**
+ * @file bench_filtre.cpp
+ * @brief Filtres genre / langue / années : texte livre par livre contre colonnes d'entiers.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Sur le même catalogue, compare trois façons de filtrer :
+ *  - texte    : l'ancienne méthode, comparaison des chaînes de chaque livre (lib.books[i]) ;
+ *  - scalaire : colonnes d'entiers, un livre à la fois ;
+ *  - sse2     : colonnes d'entiers, 8 livres à la fois (filtrerColonnes).
+ * Les trois doivent trouver exactement les mêmes livres.
+ *
+ * Pour tenir en mémoire avec 10 millions de livres, le catalogue ne garde que les champs
+ * filtrés (les autres textes sont vides).
+ *
+ * Usage : ./build/bench_filtre [nombre_de_livres]
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "utils.hpp"
+#include "bench_commun.hpp"
+
+// Un filtre de la mesure, exprimé en texte (pour l'ancienne méthode) et en numéros
+struct CasFiltre {
+    std::string nom;
+    std::string genre, langue;   // Vide = pas de critère
+    int anneeDebut, anneeFin;    // 0 = pas de critère
+};
+
+// Ancienne méthode : chaque livre est relu et ses textes comparés
+static std::vector<std::uint32_t> filtrerTexte(const CatalogueCompact& livres, const CasFiltre& cas) {
+    std::vector<std::uint32_t> resultat;
+    for (std::size_t i = 0; i < livres.size(); i++) {
+        LivreVue livre = livres[i];
+        if (!cas.genre.empty() && livre.genre != cas.genre) continue;
+        if (!cas.langue.empty() && livre.language != cas.langue) continue;
+        if (cas.anneeDebut > 0) {
+            std::uint32_t date = dateCompacte(livre.date);
+            if (date / 10000 < static_cast<std::uint32_t>(cas.anneeDebut) || date / 10000 > static_cast<std::uint32_t>(cas.anneeFin)) continue;
+        }
+        resultat.push_back(static_cast<std::uint32_t>(i));
+    }
+    return resultat;
+}
+
+static FiltreLivres enNumeros(const CatalogueCompact& livres, const CasFiltre& cas) {
+    FiltreLivres filtre;
+    if (!cas.genre.empty()) filtre.genre = livres.genres.numeros.at(cas.genre);
+    if (!cas.langue.empty()) filtre.langue = livres.langues.numeros.at(cas.langue);
+    if (cas.anneeDebut > 0) filtrerAnnees(filtre, cas.anneeDebut, cas.anneeFin);
+    return filtre;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 10000000;
+
+    CatalogueCompact livres;
+    reserverCatalogue(livres, nombre);
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        Book b = genererLivre(i);
+        LivreVue vue;
+        vue.language = b.language;
+        vue.genre = b.genre;
+        vue.date = b.date;
+        ajouterAuCatalogue(livres, vue);
+    }
+
+    Chrono chronoColonnes;
+    ColonnesLivres colonnes;
+    construireColonnes(colonnes, livres);
+    double construction = chronoColonnes.secondes();
+
+    const std::vector<CasFiltre> cas = {
+        {"genre", "Policier", "", 0, 0},
+        {"langue", "", "EN", 0, 0},
+        {"annees", "", "", 1950, 1979},
+        {"genre+langue+annees", "Roman", "FR", 2000, 2024},
+    };
+
+    std::cout << "construction des colonnes : " << construction << " s pour " << nombre << " livres" << std::endl;
+    std::cout << "filtre;livres;trouves;texte_s;scalaire_s;sse2_s;ns_par_livre_sse2;acceleration" << std::endl;
+
+    bool correct = true;
+    for (const auto& c : cas) {
+        FiltreLivres filtre = enNumeros(livres, c);
+
+        Chrono chronoTexte;
+        std::vector<std::uint32_t> parTexte = filtrerTexte(livres, c);
+        double texte = chronoTexte.secondes();
+
+        Chrono chronoScalaire;
+        std::vector<std::uint32_t> parScalaire = filtrerColonnesScalaire(colonnes, filtre);
+        double scalaire = chronoScalaire.secondes();
+
+        Chrono chronoSimd;
+        std::vector<std::uint32_t> parSimd = filtrerColonnes(colonnes, filtre);
+        double simd = chronoSimd.secondes();
+
+        std::cout << c.nom << ";" << nombre << ";" << parSimd.size() << ";" << texte << ";" << scalaire << ";"
+                  << simd << ";" << simd * 1e9 / nombre << ";" << texte / simd << std::endl;
+        correct = correct && parTexte == parScalaire && parScalaire == parSimd;
+    }
+
+    if (!correct) {
+        std::cerr << "ERREUR : les filtres ne trouvent pas les mêmes livres !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
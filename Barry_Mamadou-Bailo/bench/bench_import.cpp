@@ -0,0 +1,73 @@
+/**
+ * @file bench_import.cpp
+ * @brief Débit de l'import CSV selon le nombre de threads (1, 2, 4... jusqu'au nombre de cœurs).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Le fichier généré contient 10% de doublons (ISBN déjà vus) et quelques lignes invalides,
+ * pour vérifier au passage que le résultat est identique quel que soit le nombre de threads.
+ *
+ * Usage : ./build/bench_import [nombre_de_lignes] [threads_max]
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "import.hpp"
+#include "bench_commun.hpp"
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nbLignes = (argc > 1) ? std::stoull(argv[1]) : 500000;
+    int threadsMax = (argc > 2) ? std::stoi(argv[2]) : nombreThreadsImport(0);
+    if (threadsMax < 4) threadsMax = 4; // On mesure au moins 1, 2 et 4 threads
+    const std::string chemin = "bench_import.csv";
+
+    // 1. Génération du fichier
+    {
+        std::ofstream f(chemin);
+        f << "ISBN;Titre;Langue;Auteurs;Date;Genre;Description\n";
+        for (std::uint64_t i = 0; i < nbLignes; i++) {
+            // Une ligne sur 10 reprend un ISBN précédent, une sur 1000 n'a pas assez de colonnes
+            Book b = genererLivre(i % 10 == 9 ? i / 2 : i);
+            if (i % 1000 == 999) {
+                f << b.isbn << ";ligne invalide\n";
+                continue;
+            }
+            f << b.isbn << ';' << b.title << ';' << b.language << ';' << b.authors << ';'
+              << b.date << ';' << b.genre << ";\"" << b.description << " ; avec \"\"guillemets\"\"\"\n";
+        }
+    }
+
+    // 2. Import avec 1, 2, 4... threads : le nombre de livres et leur ordre doivent être identiques
+    std::cout << "threads;livres;lignes;secondes;lignes_par_s;acceleration" << std::endl;
+    double reference = 0;
+    std::vector<std::string> isbnReference; // Ordre des livres obtenu avec 1 thread
+    bool identique = true;
+
+    for (int threads = 1; threads <= threadsMax; threads *= 2) {
+        Library lib;
+        RapportImport rapport;
+        int ajoutes = importerReferences(lib, chemin, threads, &rapport);
+        std::vector<std::string> isbn;
+        for (const auto& b : lib.books) isbn.emplace_back(b.isbn);
+        if (threads == 1) {
+            reference = rapport.secondes;
+            isbnReference = isbn;
+        } else if (isbn != isbnReference) {
+            identique = false;
+        }
+        std::cout << threads << ";" << ajoutes << ";" << rapport.lignes << ";" << rapport.secondes << ";"
+                  << static_cast<long>(rapport.lignes / rapport.secondes) << ";"
+                  << reference / rapport.secondes << std::endl;
+    }
+
+    std::remove(chemin.c_str());
+    if (!identique) {
+        std::cerr << "ERREUR : le résultat dépend du nombre de threads !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,55 @@
+/**
+ * @file bench_isbn.cpp
+ * @brief Mesure du temps d'importation en fonction de la taille du catalogue.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * On importe toujours le même nombre de lignes CSV dans des catalogues de plus en plus gros.
+ * Avec l'index des ISBN, le temps d'import doit rester à peu près constant par ligne
+ * (croissance linéaire) au lieu d'exploser comme avec l'ancien parcours complet.
+ *
+ * Usage : ./build/bench_isbn [taille_max_catalogue] [lignes_importees]
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+int main(int argc, char* argv[]) {
+    std::uint64_t tailleMax = (argc > 1) ? std::stoull(argv[1]) : 400000;
+    std::uint64_t lignes = (argc > 2) ? std::stoull(argv[2]) : 50000;
+    const std::string csv = "bench_import.csv";
+
+    std::cout << "catalogue;lignes_importees;secondes;ns_par_ligne;recherches_isbn_ns" << std::endl;
+
+    for (std::uint64_t taille = tailleMax / 8; taille <= tailleMax; taille *= 2) {
+        Library lib;
+        initialiserBibliotheque(lib);
+        for (std::uint64_t i = 0; i < taille; i++) ajouterLivre(lib, genererLivre(i));
+
+        // La moitié des lignes importées sont des doublons (déjà dans le catalogue)
+        ecrireCSV(csv, taille - lignes / 2, lignes);
+
+        Chrono chrono;
+        importerReferences(lib, csv);
+        double duree = chrono.secondes();
+
+        // Recherches exactes d'ISBN existants
+        Chrono chronoRecherche;
+        std::size_t trouves = 0;
+        for (std::uint64_t i = 0; i < lignes; i++) {
+            trouves += isbnExiste(lib, "978-2-" + std::to_string((i * 7919) % taille));
+        }
+        double dureeRecherche = chronoRecherche.secondes();
+
+        std::cout << taille << ";" << lignes << ";" << duree << ";"
+                  << (duree * 1e9 / lignes) << ";"
+                  << (dureeRecherche * 1e9 / lignes) << std::endl;
+        if (trouves != lignes) std::cerr << "Attention : ISBN manquants !" << std::endl;
+    }
+
+    std::remove(csv.c_str());
+    return 0;
+}
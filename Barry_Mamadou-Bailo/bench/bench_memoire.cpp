@@ -0,0 +1,118 @@
+/**
+ * @file bench_memoire.cpp
+ * @brief Mémoire occupée par livre : std::vector<Book> contre catalogue compact.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Chaque mesure est faite dans un processus à part (fork), pour que la mémoire de l'une
+ * ne fausse pas l'autre : on relève la mémoire résidente maximale (RSS) du processus,
+ * avant et après avoir rangé les livres.
+ *  - vector_book : l'ancien rangement (7 std::string par livre) ;
+ *  - compact     : CatalogueCompact seul (dictionnaires + arène) ;
+ *  - library     : une Library complète (catalogue compact + index des ISBN) ;
+ *  - resultats_vues / resultats_positions : liste de résultats d'une recherche qui trouve
+ *    tous les livres (comme "a"), en plus d'une Library déjà chargée : une vue par livre
+ *    (l'ancien pager) contre une position de 4 octets par livre.
+ *
+ * Usage : ./build/bench_memoire [nombre_de_livres]   (Linux / macOS)
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/resource.h> // getrusage : mémoire résidente maximale
+#include <sys/wait.h>     // waitpid
+#include <unistd.h>       // fork
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+// Mémoire résidente maximale du processus, en octets
+static double memoireResidente() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return static_cast<double>(usage.ru_maxrss);        // Déjà en octets sur macOS
+#else
+    return static_cast<double>(usage.ru_maxrss) * 1024; // En Ko sous Linux
+#endif
+}
+
+// Lance 'mesure' dans un processus fils et affiche le résultat. Retourne false en cas d'échec.
+// 'preparation' est exécutée avant la première mesure de mémoire : seul ce qu'ajoute
+// 'mesure' est compté (elle reçoit ce que la préparation a construit).
+template <typename Preparation, typename Mesure>
+static bool mesurerDansFils(const std::string& nom, std::uint64_t nombre, Preparation preparation, Mesure mesure) {
+    pid_t fils = fork();
+    if (fils < 0) return false;
+    if (fils == 0) {
+        auto prepare = preparation();
+        double avant = memoireResidente();
+        Chrono chrono;
+        std::size_t verification = mesure(prepare);
+        double secondes = chrono.secondes();
+        double apres = memoireResidente();
+        std::cout << nom << ";" << nombre << ";" << (apres - avant) / (1 << 20) << ";"
+                  << (apres - avant) / nombre << ";" << secondes << std::endl;
+        _exit(verification == nombre ? 0 : 1);
+    }
+    int statut = 0;
+    waitpid(fils, &statut, 0);
+    return WIFEXITED(statut) && WEXITSTATUS(statut) == 0;
+}
+
+// Sans préparation
+template <typename Mesure>
+static bool mesurerDansFils(const std::string& nom, std::uint64_t nombre, Mesure mesure) {
+    return mesurerDansFils(nom, nombre, [] { return 0; }, [&mesure](int) { return mesure(); });
+}
+
+// Préparation des mesures de résultats : une Library de 'nombre' livres
+static Library chargerLibrary(std::uint64_t nombre) {
+    Library lib;
+    initialiserBibliotheque(lib);
+    reserverCatalogue(lib.books, nombre);
+    for (std::uint64_t i = 0; i < nombre; i++) ajouterLivre(lib, genererLivre(i));
+    isbnExiste(lib, ""); // L'index des ISBN n'est construit qu'à la première recherche (comme à l'import)
+    return lib;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 5000000;
+    std::cout << "rangement;livres;rss_Mo;octets_par_livre;secondes" << std::endl;
+
+    bool correct = true;
+    correct = correct && mesurerDansFils("vector_book", nombre, [nombre] {
+        std::vector<Book> livres;
+        livres.reserve(nombre);
+        for (std::uint64_t i = 0; i < nombre; i++) livres.push_back(genererLivre(i));
+        return livres.size();
+    });
+    correct = correct && mesurerDansFils("compact", nombre, [nombre] {
+        CatalogueCompact catalogue;
+        reserverCatalogue(catalogue, nombre);
+        for (std::uint64_t i = 0; i < nombre; i++) ajouterAuCatalogue(catalogue, vueLivre(genererLivre(i)));
+        return catalogue.size();
+    });
+    correct = correct && mesurerDansFils("library", nombre, [nombre] {
+        return chargerLibrary(nombre).books.size();
+    });
+    // Une recherche qui trouve tout le catalogue (les deux listes sont remplies de la même façon)
+    correct = correct && mesurerDansFils("resultats_vues", nombre, [nombre] { return chargerLibrary(nombre); },
+        [](const Library& lib) {
+            std::vector<LivreVue> resultats;
+            for (std::size_t i = 0; i < lib.books.size(); i++) resultats.push_back(lib.books[i]);
+            return resultats.size();
+        });
+    correct = correct && mesurerDansFils("resultats_positions", nombre, [nombre] { return chargerLibrary(nombre); },
+        [](const Library& lib) {
+            std::vector<std::uint32_t> resultats;
+            for (std::size_t i = 0; i < lib.books.size(); i++) resultats.push_back(static_cast<std::uint32_t>(i));
+            return resultats.size();
+        });
+
+    if (!correct) {
+        std::cerr << "ERREUR : une mesure a échoué !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
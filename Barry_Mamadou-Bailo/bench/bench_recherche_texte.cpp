@@ -0,0 +1,97 @@
+/**
+ * @file bench_recherche_texte.cpp
+ * @brief Débit de la recherche par titre (Go/s) : toLower + find contre recherche_texte.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Les titres de 10 millions de livres réalistes (mots accentués, quelques longs sous-titres)
+ * sont rangés bout à bout dans une seule colonne de texte. Chaque requête parcourt toute la
+ * colonne avec :
+ *  - ancienne : l'ancienne méthode, copie du titre en minuscules puis std::string::find ;
+ *  - scalaire, sse2, avx2 : les versions de recherche_texte (celles disponibles ici).
+ * Toutes doivent trouver exactement le même nombre de titres. Le débit est la taille de la
+ * colonne divisée par le temps du parcours.
+ *
+ * Usage : ./build/bench_recherche_texte [nombre_de_titres]
+ */
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "recherche_texte.hpp"
+#include "utils.hpp"
+#include "bench_commun.hpp"
+
+// Colonne de titres : tous les textes à la suite, et le début de chacun
+struct ColonneTitres {
+    std::string texte;
+    std::vector<std::size_t> debuts; // debuts[i] .. debuts[i + 1] : titre i
+
+    std::size_t size() const { return debuts.size() - 1; }
+    std::string_view operator[](std::size_t i) const {
+        return std::string_view(texte).substr(debuts[i], debuts[i + 1] - debuts[i]);
+    }
+};
+
+// Seulement le titre du livre réaliste numéro 'i' (même début de tirage que genererLivreRealiste)
+static ColonneTitres genererTitres(std::uint64_t nombre) {
+    ColonneTitres colonne;
+    colonne.debuts.reserve(nombre + 1);
+    colonne.debuts.push_back(0);
+    for (std::uint64_t i = 0; i < nombre; i++) {
+        Hasard h = hasardDuLivre(i);
+        isbnRealiste(i, h);
+        colonne.texte += phrase(h, 1 + h.inegal(5));
+        if (h.suivant() % 10 == 0) colonne.texte += " : " + phrase(h, h.entre(3, 15));
+        colonne.debuts.push_back(colonne.texte.size());
+    }
+    return colonne;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 10000000;
+
+    ColonneTitres titres = genererTitres(nombre);
+    const double gigaOctets = static_cast<double>(titres.texte.size()) / 1e9;
+    std::cout << "colonne : " << nombre << " titres, " << titres.texte.size() / 1000000 << " Mo ; version automatique : "
+              << nomNoyau(noyauAutomatique()) << std::endl;
+
+    // Fréquente, rare en majuscules, absente (parcours complet), accentuée, une seule lettre, longue
+    const char* requetes[] = {"mon", "CHARBEAU", "xyz", "pré", "e", "Laritra vermin"};
+    const NoyauRecherche noyaux[] = {NOYAU_SCALAIRE, NOYAU_SSE2, NOYAU_AVX2};
+
+    std::cout << "requete;methode;trouves;secondes;go_par_s;acceleration" << std::endl;
+    bool correct = true;
+    for (const char* requete : requetes) {
+        // Ancienne méthode : une copie en minuscules par titre
+        std::string cherche = toLower(requete);
+        std::size_t trouvesAncienne = 0;
+        Chrono chronoAncienne;
+        for (std::size_t i = 0; i < titres.size(); i++) {
+            if (toLower(titres[i]).find(cherche) != std::string::npos) trouvesAncienne++;
+        }
+        double ancienne = chronoAncienne.secondes();
+        std::cout << requete << ";ancienne;" << trouvesAncienne << ";" << ancienne << ";" << gigaOctets / ancienne << ";1" << std::endl;
+
+        for (NoyauRecherche noyau : noyaux) {
+            if (!noyauDisponible(noyau)) continue;
+            MotifRecherche motif = preparerMotif(requete, true, noyau);
+            std::size_t trouves = 0;
+            Chrono chrono;
+            for (std::size_t i = 0; i < titres.size(); i++) {
+                if (contientMotif(titres[i], motif)) trouves++;
+            }
+            double secondes = chrono.secondes();
+            std::cout << requete << ";" << nomNoyau(noyau) << ";" << trouves << ";" << secondes << ";"
+                      << gigaOctets / secondes << ";" << ancienne / secondes << std::endl;
+            correct = correct && trouves == trouvesAncienne;
+        }
+    }
+
+    if (!correct) {
+        std::cerr << "ERREUR : les versions ne trouvent pas les mêmes titres !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file bench_sauvegarde.cpp
+ * @brief Temps de sauvegarde après l'ajout d'un livre : réécriture complète contre journal.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * La réécriture complète dépend de la taille du catalogue ; l'ajout au journal ne dépend
+ * que de ce qui a changé. On vérifie aussi que le rechargement redonne le bon catalogue.
+ *
+ * Usage : ./build/bench_sauvegarde [nombre_de_livres]
+ */
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "library.hpp"
+#include "journal.hpp"
+#include "bench_commun.hpp"
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 500000;
+    const std::string fichier = "bench_sauvegarde.db";
+
+    Library lib;
+    initialiserBibliotheque(lib);
+    for (std::uint64_t i = 0; i < nombre; i++) ajouterLivre(lib, genererLivre(i));
+    std::remove(fichier.c_str());
+    supprimerJournaux(fichier);
+    sauvegarderBibliotheque(lib, fichier); // Premier enregistrement : fichier complet
+
+    // 1. Ancienne méthode : un livre de plus, tout le fichier est réécrit
+    ajouterLivre(lib, genererLivre(nombre));
+    Chrono chronoComplet;
+    sauvegarderInstantane(lib, fichier);
+    double complet = chronoComplet.secondes();
+    marquerCommeEcrit(lib);
+
+    // 2. Journal : un livre de plus, une ligne ajoutée
+    ajouterLivre(lib, genererLivre(nombre + 1));
+    Chrono chronoJournal;
+    sauvegarderBibliotheque(lib, fichier);
+    double journal = chronoJournal.secondes();
+
+    std::cout << "livres;reecriture_complete_s;journal_s;acceleration" << std::endl;
+    std::cout << nombre << ";" << complet << ";" << journal << ";" << complet / journal << std::endl;
+
+    Library relue;
+    chargerBibliotheque(relue, fichier);
+    std::remove(fichier.c_str());
+    supprimerJournaux(fichier);
+    if (relue.books.size() != lib.books.size() || relue.books.back().isbn != lib.books.back().isbn) {
+        std::cerr << "ERREUR : le catalogue relu ne correspond pas !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
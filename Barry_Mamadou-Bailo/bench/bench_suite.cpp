@@ -0,0 +1,193 @@
+/**
+ * @file bench_suite.cpp
+ * @brief Suite de mesures reproductible sur des catalogues réalistes (lancée par "make bench").
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Pour chaque taille demandée, un catalogue CSV réaliste est généré (genererLivreRealiste :
+ * toujours les mêmes livres pour une même taille), puis chaque opération est mesurée :
+ *  - import       : importerReferences du fichier CSV dans une bibliothèque vide ;
+ *  - sauvegarde   : sauvegarderBibliotheque quand le fichier DB n'existe pas (écriture complète) ;
+ *  - chargement   : chargerBibliotheque du fichier DB écrit juste avant ;
+ *  - export_html  : exporterHTML de tout le catalogue (tri par titre compris) ;
+ *  - isbn_existe  : 1 million d'appels à isbnExiste, un sur deux pour un ISBN absent ;
+ *  - recherche_titre : rechercherTitre poussé jusqu'à la fin du catalogue.
+ *
+ * Chaque mesure est faite dans un processus à part (fork) : la préparation (non chronométrée)
+ * et la mémoire d'une mesure ne faussent pas les suivantes, et "rss_pic_mo" est bien la
+ * mémoire résidente maximale atteinte pendant cette opération-là.
+ *
+ * Chaque résultat est une ligne JSON (facile à comparer d'une version à l'autre) :
+ *   {"operation":"import","livres":100000,"operations":100000,"secondes":0.41,
+ *    "ns_par_op":4100,"ops_par_s":243902,"mo_par_s":95.2,"rss_pic_mo":180.5}
+ * "mo_par_s" n'est donné que pour les opérations qui lisent ou écrivent un fichier.
+ *
+ * Usage : ./build/bench_suite [taille1 taille2 ...]   (par défaut : 10000 100000 1000000)
+ * Jusqu'à 50 millions de livres, à condition d'avoir la mémoire et le disque nécessaires
+ * (environ 15 Go de CSV pour 50 millions).
+ */
+
+#include <cstdio>   // std::remove
+#include <cstdlib>  // std::exit
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility> // Pour std::pair
+#include <vector>
+#include <sys/resource.h> // getrusage : mémoire résidente maximale
+#include <sys/wait.h>     // waitpid
+#include <unistd.h>       // fork
+#include "library.hpp"
+#include "bench_commun.hpp"
+
+static const std::string FICHIER_CSV = "bench_suite.csv";
+static const std::string FICHIER_DB = "bench_suite.db";
+static const std::string FICHIER_HTML = "bench_suite.html";
+
+// Ce que mesure une opération : nombre d'opérations faites et octets lus ou écrits (0 si sans objet)
+struct Travail {
+    std::uint64_t operations = 0;
+    std::uint64_t octets = 0;
+};
+
+// Mémoire résidente maximale du processus, en Mo
+static double memoireResidenteMaxMo() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return static_cast<double>(usage.ru_maxrss) / (1 << 20); // En octets sur macOS
+#else
+    return static_cast<double>(usage.ru_maxrss) / 1024;      // En Ko sous Linux
+#endif
+}
+
+// Taille d'un fichier en octets (0 s'il n'existe pas)
+static std::uint64_t tailleFichier(const std::string& chemin) {
+    std::ifstream f(chemin, std::ios::binary | std::ios::ate);
+    return f ? static_cast<std::uint64_t>(f.tellg()) : 0;
+}
+
+// Supprime le fichier DB et ses fichiers annexes (journal, fichier temporaire)
+static void supprimerDB() {
+    std::remove(FICHIER_DB.c_str());
+    std::remove((FICHIER_DB + ".journal").c_str());
+    std::remove((FICHIER_DB + ".tmp").c_str());
+}
+
+// Bibliothèque remplie depuis le CSV (préparation de la plupart des mesures)
+static Library bibliothequeImportee() {
+    Library lib;
+    initialiserBibliotheque(lib);
+    importerReferences(lib, FICHIER_CSV);
+    return lib;
+}
+
+// Lance 'mesure' dans un processus fils, après 'preparation' (non chronométrée),
+// et affiche le résultat en une ligne JSON. Retourne false en cas d'échec.
+template <typename Preparation, typename Mesure>
+static bool mesurerDansFils(const std::string& nom, std::uint64_t livres, Preparation preparation, Mesure mesure) {
+    std::cout.flush(); // Sinon le fils réécrirait ce qui est encore dans le tampon
+    pid_t fils = fork();
+    if (fils < 0) return false;
+    if (fils == 0) {
+        auto prepare = preparation();
+        Chrono chrono;
+        Travail travail = mesure(prepare);
+        double secondes = chrono.secondes();
+        // std::exit et non _exit : la version instrumentée de "make pgo" n'écrit ses profils
+        // (fichiers .gcda) qu'à la sortie normale du programme, et c'est le fils qui a travaillé
+        if (travail.operations == 0) std::exit(1);
+
+        std::cout << "{\"operation\":\"" << nom << "\",\"livres\":" << livres
+                  << ",\"operations\":" << travail.operations << ",\"secondes\":" << secondes
+                  << ",\"ns_par_op\":" << secondes * 1e9 / static_cast<double>(travail.operations)
+                  << ",\"ops_par_s\":" << static_cast<double>(travail.operations) / secondes;
+        if (travail.octets > 0) std::cout << ",\"mo_par_s\":" << static_cast<double>(travail.octets) / (1 << 20) / secondes;
+        std::cout << ",\"rss_pic_mo\":" << memoireResidenteMaxMo() << "}" << std::endl;
+        std::exit(0);
+    }
+    int statut = 0;
+    waitpid(fils, &statut, 0);
+    return WIFEXITED(statut) && WEXITSTATUS(statut) == 0;
+}
+
+// Toutes les mesures pour un catalogue de 'livres' livres. Retourne false si l'une échoue.
+static bool mesurerTaille(std::uint64_t livres) {
+    std::uint64_t octetsCSV = ecrireCSVRealiste(FICHIER_CSV, livres);
+    supprimerDB();
+    bool correct = true;
+
+    correct = correct && mesurerDansFils("import", livres, [] {
+        Library lib;
+        initialiserBibliotheque(lib);
+        return lib;
+    }, [livres, octetsCSV](Library& lib) {
+        int ajoutes = importerReferences(lib, FICHIER_CSV);
+        return Travail{ajoutes == static_cast<int>(livres) ? livres : 0, octetsCSV};
+    });
+
+    // Écrit le fichier DB utilisé ensuite par la mesure du chargement
+    correct = correct && mesurerDansFils("sauvegarde", livres, bibliothequeImportee, [livres](Library& lib) {
+        sauvegarderBibliotheque(lib, FICHIER_DB);
+        return Travail{livres, tailleFichier(FICHIER_DB)};
+    });
+
+    correct = correct && mesurerDansFils("chargement", livres, [] {
+        Library lib;
+        initialiserBibliotheque(lib);
+        return lib;
+    }, [livres](Library& lib) {
+        bool charge = chargerBibliotheque(lib, FICHIER_DB) == CHARGE_OK && lib.books.size() == livres;
+        return Travail{charge ? livres : 0, tailleFichier(FICHIER_DB)};
+    });
+
+    correct = correct && mesurerDansFils("export_html", livres, bibliothequeImportee, [livres](Library& lib) {
+        exporterHTML(lib, FICHIER_HTML);
+        return Travail{livres, tailleFichier(FICHIER_HTML)};
+    });
+
+    // ISBN demandés préparés à l'avance : un présent (livre au hasard), un absent (au-delà du dernier)
+    correct = correct && mesurerDansFils("isbn_existe", livres, [livres] {
+        const std::uint64_t appels = 1000000;
+        std::vector<std::string> demandes;
+        demandes.reserve(appels);
+        Hasard h{42};
+        for (std::uint64_t a = 0; a < appels; a++) {
+            std::uint64_t numero = (a % 2 == 0) ? h.suivant() % livres : livres + h.suivant() % livres;
+            demandes.push_back(isbnDuLivreRealiste(numero));
+        }
+        return std::make_pair(bibliothequeImportee(), demandes);
+    }, [](std::pair<Library, std::vector<std::string>>& prepare) {
+        std::uint64_t presents = 0;
+        for (const auto& isbn : prepare.second) presents += isbnExiste(prepare.first, isbn);
+        bool correct = presents == prepare.second.size() / 2;
+        return Travail{correct ? prepare.second.size() : 0, 0};
+    });
+
+    // Une syllabe fréquente : beaucoup de résultats, comme une recherche courte dans le menu
+    correct = correct && mesurerDansFils("recherche_titre", livres, bibliothequeImportee, [livres](Library& lib) {
+        CurseurRecherche curseur = rechercherTitre(lib, "mon");
+        avancerCurseur(curseur, std::numeric_limits<std::size_t>::max());
+        return Travail{curseurTermine(curseur) ? livres : 0, 0};
+    });
+
+    std::remove(FICHIER_CSV.c_str());
+    std::remove(FICHIER_HTML.c_str());
+    supprimerDB();
+    return correct;
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::uint64_t> tailles;
+    for (int i = 1; i < argc; i++) tailles.push_back(std::stoull(argv[i]));
+    if (tailles.empty()) tailles = {10000, 100000, 1000000};
+
+    for (std::uint64_t livres : tailles) {
+        if (livres == 0 || !mesurerTaille(livres)) {
+            std::cerr << "ERREUR : une mesure a échoué pour " << livres << " livres !" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,52 @@
+/**
+ * @file bench_texte.cpp
+ * @brief Mesure de la recherche plein texte (index inversé) contre un parcours complet.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Usage : ./build/bench_texte [nombre_de_livres]
+ */
+
+#include <iostream>
+#include <string>
+#include "library.hpp"
+#include "utils.hpp"
+#include "bench_commun.hpp"
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 200000;
+
+    Library lib;
+    initialiserBibliotheque(lib);
+    for (std::uint64_t i = 0; i < nombre; i++) ajouterLivre(lib, genererLivre(i));
+
+    // Construction de l'index (faite une seule fois, à la première recherche)
+    Chrono chronoIndex;
+    rechercherPleinTexte(lib, "construction");
+    double construction = chronoIndex.secondes();
+    std::cout << "livres;construction_index_s;termes" << std::endl;
+    std::cout << nombre << ";" << construction << ";" << lib.indexTexte.termes.size() << std::endl;
+
+    const char* requetes[] = {"4242", "auteur 4242", "4242 OU 777", "424*", "policier 1234"};
+    const int repetitions = 200;
+
+    std::cout << "requete;resultats;index_us;parcours_titres_us" << std::endl;
+    for (const char* requete : requetes) {
+        std::size_t nbResultats = 0;
+        Chrono chrono;
+        for (int r = 0; r < repetitions; r++) nbResultats = rechercherPleinTexte(lib, requete).size();
+        double index = chrono.secondes() / repetitions;
+
+        // Référence : l'ancienne méthode (toLower + find sur chaque titre), un seul passage
+        std::string cherche = toLower(requete);
+        std::size_t trouves = 0;
+        Chrono chronoParcours;
+        for (const auto& livre : lib.books) {
+            if (toLower(livre.title).find(cherche) != std::string::npos) trouves++;
+        }
+        double parcours = chronoParcours.secondes();
+
+        std::cout << requete << ";" << nbResultats << ";" << index * 1e6 << ";" << parcours * 1e6 << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file bench_tris.cpp
+ * @brief Listes triées du menu : tri complet à chaque affichage contre index des tris.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Sur un catalogue réaliste, pour chaque ordre (titre, auteur, date, ISBN) :
+ *  - tri complet : trier toutes les positions avec la comparaison des textes (ce que
+ *    l'export HTML fait encore, et ce qu'il faudrait refaire pour chaque page affichée) ;
+ *  - index       : construction de l'index (une seule fois), puis lecture d'une page ;
+ *  - ajout       : 1000 livres ajoutés après construction, rangés à la question suivante ;
+ *  - résultats   : une liste de 1 % et de 50 % des livres rangée dans l'ordre (trierSelon)
+ *                  contre son tri avec la comparaison des textes.
+ * L'ordre de l'index doit être celui du tri complet (et, par titre, celui de l'export).
+ *
+ * Usage : ./build/bench_tris [nombre_de_livres]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "library.hpp"
+#include "export_html.hpp"
+#include "bench_commun.hpp"
+
+static const char* NOMS[NB_ORDRES_TRI] = {"titre", "auteur", "date", "isbn"};
+
+// ISBN normalisé (comme normaliserIsbn) dans un tableau sur la pile, sans allocation
+static std::string_view isbnSurPile(std::string_view isbn, char (&tampon)[64]) {
+    std::size_t n = 0;
+    for (char c : isbn) {
+        if (c == '-' || c == ' ' || c == '\r' || n == sizeof(tampon)) continue;
+        tampon[n++] = static_cast<char>(majuscule(c));
+    }
+    return std::string_view(tampon, n);
+}
+
+// Référence : comparaison directe des textes, sans allocation (comme l'export) et sans clé
+// courte ; à clé égale, l'ordre du catalogue
+static bool avantReference(const Library& lib, OrdreTri ordre, std::uint32_t a, std::uint32_t b) {
+    LivreVue la = lib.books[a], lb = lib.books[b];
+    int diff = 0;
+    if (ordre == TRI_TITRE) {
+        diff = comparerTitres(la.title, longueurArticle(la.title), lb.title, longueurArticle(lb.title));
+    } else if (ordre == TRI_AUTEUR) {
+        diff = comparerTitres(la.authors, 0, lb.authors, 0);
+    } else if (ordre == TRI_DATE) {
+        std::uint32_t da = lib.books.livres[a].date, db = lib.books.livres[b].date;
+        if (da == 0) da = 0xFFFFFFFF;
+        if (db == 0) db = 0xFFFFFFFF;
+        diff = da < db ? -1 : (da > db ? 1 : 0);
+    } else {
+        char tamponA[64], tamponB[64];
+        diff = isbnSurPile(la.isbn, tamponA).compare(isbnSurPile(lb.isbn, tamponB));
+    }
+    return diff != 0 ? diff < 0 : a < b;
+}
+
+static void trierReference(const Library& lib, OrdreTri ordre, std::vector<std::uint32_t>& positions) {
+    std::sort(positions.begin(), positions.end(), [&lib, ordre](std::uint32_t a, std::uint32_t b) {
+        return avantReference(lib, ordre, a, b);
+    });
+}
+
+static std::vector<std::uint32_t> tousLesLivres(const Library& lib) {
+    std::vector<std::uint32_t> tous(lib.books.size());
+    for (std::size_t i = 0; i < tous.size(); i++) tous[i] = static_cast<std::uint32_t>(i);
+    return tous;
+}
+
+// Un livre sur 'pas' (une liste de résultats dans l'ordre du catalogue)
+static std::vector<std::uint32_t> unSur(const Library& lib, std::size_t pas) {
+    std::vector<std::uint32_t> liste;
+    for (std::size_t i = 0; i < lib.books.size(); i += pas) liste.push_back(static_cast<std::uint32_t>(i));
+    return liste;
+}
+
+int main(int argc, char* argv[]) {
+    std::uint64_t nombre = (argc > 1) ? std::stoull(argv[1]) : 1000000;
+    const std::uint64_t ajouts = 1000;
+    const std::size_t livresParPage = 10;
+
+    Library lib;
+    initialiserBibliotheque(lib);
+    reserverCatalogue(lib.books, nombre + ajouts);
+    for (std::uint64_t i = 0; i < nombre; i++) ajouterLivre(lib, genererLivreRealiste(i));
+
+    bool correct = true;
+
+    // L'ordre par titre de l'index doit être exactement celui de l'export HTML, et celui des
+    // titres nettoyés (nettoyerTitrePourTri) comparés comme des std::string
+    std::vector<CleTri> export_ = trierParTitre(lib);
+    const std::vector<std::uint32_t>& parTitre = livresDansOrdre(lib, TRI_TITRE);
+    for (std::size_t i = 0; i < export_.size(); i++) {
+        correct = correct && export_[i].position == parTitre[i];
+        if (i > 0) {
+            int diff = nettoyerTitrePourTri(lib.books[parTitre[i - 1]].title).compare(nettoyerTitrePourTri(lib.books[parTitre[i]].title));
+            correct = correct && (diff < 0 || (diff == 0 && parTitre[i - 1] < parTitre[i]));
+        }
+    }
+
+    std::cout << "ordre;livres;tri_complet_s;construction_s;page_us;ajout_ms;resultats_1pc_ms;trie_1pc_ms;"
+                 "resultats_50pc_ms;trie_50pc_ms" << std::endl;
+    for (int o = 0; o < NB_ORDRES_TRI; o++) {
+        OrdreTri ordre = static_cast<OrdreTri>(o);
+        viderIndexTris(lib.indexTris);
+
+        // Tri complet des positions (à refaire à chaque affichage sans index)
+        std::vector<std::uint32_t> reference = tousLesLivres(lib);
+        Chrono chronoComplet;
+        trierReference(lib, ordre, reference);
+        double complet = chronoComplet.secondes();
+
+        Chrono chronoConstruction;
+        const std::vector<std::uint32_t>& index = livresDansOrdre(lib, ordre);
+        double construction = chronoConstruction.secondes();
+        correct = correct && index == reference;
+
+        // Une page au milieu de la liste : lecture directe dans l'index
+        const int repetitions = 1000;
+        std::size_t page = index.size() / livresParPage / 2;
+        std::size_t lettres = 0;
+        Chrono chronoPage;
+        for (int r = 0; r < repetitions; r++) {
+            const std::vector<std::uint32_t>& vue = livresDansOrdre(lib, ordre);
+            for (std::size_t i = page * livresParPage; i < std::min(vue.size(), (page + 1) * livresParPage); i++) {
+                lettres += lib.books[vue[i]].title.size();
+            }
+        }
+        double tempsPage = chronoPage.secondes() * 1e6 / repetitions;
+
+        // Résultats de recherche à ranger dans l'ordre : 1 % et 50 % du catalogue
+        double tempsListes[2][2];
+        const std::size_t pas[2] = {100, 2};
+        for (int k = 0; k < 2; k++) {
+            std::vector<std::uint32_t> attendus = unSur(lib, pas[k]);
+            Chrono chronoTexte;
+            trierReference(lib, ordre, attendus);
+            tempsListes[k][0] = chronoTexte.secondes() * 1000;
+
+            std::vector<std::uint32_t> liste = unSur(lib, pas[k]);
+            Chrono chronoIndex;
+            trierSelon(lib, ordre, liste);
+            tempsListes[k][1] = chronoIndex.secondes() * 1000;
+            correct = correct && liste == attendus;
+        }
+
+        // Ajouts après construction (un petit import) : rangés à la question suivante
+        for (std::uint64_t i = 0; i < ajouts; i++) ajouterLivre(lib, genererLivreRealiste(nombre + i));
+        Chrono chronoAjout;
+        const std::vector<std::uint32_t>& apresAjout = livresDansOrdre(lib, ordre);
+        double tempsAjout = chronoAjout.secondes() * 1000;
+        std::vector<std::uint32_t> attenduAjout = tousLesLivres(lib);
+        trierReference(lib, ordre, attenduAjout);
+        correct = correct && apresAjout == attenduAjout && lettres > 0;
+
+        // Retour au catalogue de départ pour l'ordre suivant (les index sont reconstruits)
+        while (lib.books.size() > nombre) retirerDuCatalogue(lib.books, lib.books.size() - 1);
+        reconstruireIndex(lib);
+
+        std::cout << NOMS[o] << ";" << nombre << ";" << complet << ";" << construction << ";" << tempsPage << ";"
+                  << tempsAjout << ";" << tempsListes[0][0] << ";" << tempsListes[0][1] << ";"
+                  << tempsListes[1][0] << ";" << tempsListes[1][1] << std::endl;
+    }
+
+    if (!correct) {
+        std::cerr << "ERREUR : l'index ne donne pas le même ordre que le tri complet !" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file bitmap_compresse.hpp
+ * @brief Ensembles de positions compressés (à la manière des "roaring bitmaps").
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Un ensemble de livres (ex: "tous les romans") peut se ranger de deux façons :
+ *  - un tableau de bits, un par livre du catalogue : 625 Ko sur 5 millions de livres,
+ *    même s'il n'y a que 3 romans ;
+ *  - une liste de positions : 4 octets par livre, 20 Mo si presque tout est roman.
+ *
+ * On prend donc le meilleur des deux, bloc par bloc. Les positions sont découpées en
+ * blocs de 65 536 : les 16 bits hauts donnent le bloc, les 16 bits bas sont rangés dans
+ * le bloc, soit en liste triée (2 octets par livre) tant qu'il y en a au plus MAX_LISTE,
+ * soit en tableau de 65 536 bits (8 Ko, plus petit que la liste au-delà de 4096 livres).
+ * Un bloc sans aucun livre n'existe pas.
+ *
+ * Croiser deux ensembles (ET) ne regarde que les blocs présents des deux côtés : deux
+ * tableaux de bits se croisent 64 livres à la fois (un ET et un popcount par mot de 64
+ * bits), une liste se croise en testant chacune de ses positions dans l'autre bloc.
+ * Compter les livres communs se fait sans rien construire.
+ */
+
+#ifndef BITMAP_COMPRESSE_HPP
+#define BITMAP_COMPRESSE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Au-delà de ce nombre de livres, un bloc passe de la liste au tableau de bits
+const std::uint32_t MAX_LISTE = 4096;
+
+// Nombre de mots de 64 bits d'un bloc en tableau de bits (65 536 bits)
+const std::size_t MOTS_PAR_BLOC = 1024;
+
+// Les livres d'un ensemble dont la position commence par 'haut' (16 bits hauts)
+struct BlocBits {
+    std::uint32_t haut = 0;             // Positions haut * 65 536 à haut * 65 536 + 65 535
+    std::uint32_t nombre = 0;           // Nombre de livres dans le bloc
+    std::vector<std::uint16_t> liste;   // 16 bits bas, croissants (si nombre <= MAX_LISTE)
+    std::vector<std::uint64_t> bits;    // Sinon : MOTS_PAR_BLOC mots, bit i = livre présent
+};
+
+struct BitmapCompresse {
+    std::vector<BlocBits> blocs;        // Par 'haut' croissant
+    std::uint32_t nombre = 0;           // Nombre total de livres
+};
+
+// Ajoute une position. Les positions doivent arriver dans l'ordre croissant (c'est le cas
+// des livres, toujours ajoutés à la fin du catalogue).
+void ajouterPosition(BitmapCompresse& ensemble, std::uint32_t position);
+
+// Nombre de positions présentes dans les deux ensembles (sans construire leur ET).
+std::uint32_t compterCommuns(const BitmapCompresse& a, const BitmapCompresse& b);
+
+// Nombre de positions communes entre 'base' et chacun des 'autres' (ex: une sélection et
+// chacun des 20 genres). Chaque bloc de 'base' est mis une seule fois en tableau de bits,
+// puis croisé avec le bloc de même numéro de chaque autre ensemble : tester une position
+// coûte alors un seul accès, au lieu d'avancer dans deux listes.
+std::vector<std::uint32_t> compterCommunsPlusieurs(const BitmapCompresse& base, const std::vector<const BitmapCompresse*>& autres);
+
+// Positions présentes dans les deux ensembles.
+BitmapCompresse intersection(const BitmapCompresse& a, const BitmapCompresse& b);
+
+// Toutes les positions de l'ensemble, par ordre croissant.
+std::vector<std::uint32_t> positionsBitmap(const BitmapCompresse& ensemble);
+
+// Mémoire occupée par l'ensemble (blocs et leur contenu), en octets.
+std::size_t octetsBitmap(const BitmapCompresse& ensemble);
+
+#endif // BITMAP_COMPRESSE_HPP
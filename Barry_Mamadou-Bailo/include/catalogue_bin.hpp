@@ -0,0 +1,123 @@
+/**
+ * @file catalogue_bin.hpp
+ * @brief Format binaire du catalogue (chargement rapide par projection mémoire).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Le fichier texte library.db doit être découpé ligne par ligne au démarrage,
+ * ce qui devient lent sur de gros catalogues. Ce format binaire versionné
+ * est lu directement en mémoire (mmap) sans analyse :
+ *
+ *   [ En-tête fixe ][ Table : une entrée de taille fixe par livre ][ Tas de chaînes ]
+ *
+ * Version 3 : la table est rangée exactement comme le catalogue compact en mémoire (une
+ * LivreCompact par livre, voir catalogue_compact.hpp), suivie de l'ordre des livres par
+ * ISBN et des dictionnaires des langues et des genres :
+ *
+ *   [ En-tête ][ Table ][ Ordre des ISBN ][ Dictionnaires ][ Tas de chaînes ]
+ *
+ * Le chargement ne copie donc rien : le catalogue utilise la table et le tas du fichier
+ * projeté, et l'index des ISBN fait ses recherches dans l'ordre rangé (index_isbn.hpp).
+ * Le système ne lit les pages du fichier que lorsqu'un livre est consulté.
+ *
+ * Les versions 1 et 2 (une entrée de 7 longueurs par livre, champs dans l'ordre de Book)
+ * restent lisibles : leurs livres sont copiés dans le catalogue, comme avant.
+ * Les entiers sont stockés dans l'ordre natif de la machine (little-endian sur x86/ARM).
+ */
+
+#ifndef CATALOGUE_BIN_HPP
+#define CATALOGUE_BIN_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "library.hpp"
+
+// Signature placée au début du fichier pour le reconnaître ("BIBLIOB" + octet nul)
+const char MAGIQUE_CATALOGUE[8] = {'B', 'I', 'B', 'L', 'I', 'O', 'B', '\0'};
+
+// À incrémenter à chaque changement incompatible du format.
+// Version 2 : somme de contrôle de tout ce qui suit l'en-tête (la version 1 reste lisible).
+// Version 3 : table du catalogue compact, ordre des ISBN et dictionnaires ; deux sommes.
+const std::uint32_t VERSION_CATALOGUE = 3;
+
+// Les champs d'un livre dans le tas des versions 1 et 2
+enum ChampLivre {
+    CHAMP_ISBN, CHAMP_TITRE, CHAMP_LANGUE, CHAMP_AUTEURS,
+    CHAMP_DATE, CHAMP_GENRE, CHAMP_DESCRIPTION,
+    NB_CHAMPS
+};
+
+// En-tête du fichier (taille fixe : 48 octets)
+struct EnTeteCatalogue {
+    char magique[8];             // MAGIQUE_CATALOGUE
+    std::uint32_t version;       // VERSION_CATALOGUE
+    std::uint32_t nbLivres;      // Nombre d'entrées dans la table
+    std::uint64_t tailleTas;     // Taille du tas de chaînes en octets (à la fin du fichier)
+    std::uint32_t tailleNom;     // Le nom et la description de la bibliothèque
+    std::uint32_t tailleDescription; // sont rangés au tout début du tas
+    // Version 2 : somme de la table et du tas. Version 3 : somme de tout ce qui est entre
+    // l'en-tête et le tas (table, ordre, dictionnaires), vérifiée à chaque ouverture.
+    std::uint64_t sommeControle;
+    std::uint64_t sommeTas;      // Version 3 : somme du tas (versions 1 et 2 : zéro)
+};
+
+// Une entrée de la table des versions 1 et 2 (taille fixe : 40 octets par livre)
+struct EntreeLivre {
+    std::uint64_t debut;                 // Position du premier champ dans le tas
+    std::uint32_t tailles[NB_CHAMPS];    // Longueur de chaque champ
+    std::uint32_t reserve;               // Alignement sur 8 octets
+};
+
+// Version 3 : début des dictionnaires, suivi d'une EntreeValeur par langue puis par genre
+struct EnTeteDictionnaires {
+    std::uint32_t nbLangues;
+    std::uint32_t nbGenres;
+};
+
+struct EntreeValeur {
+    std::uint64_t debut;     // Position du texte dans le tas
+    std::uint32_t taille;
+    std::uint32_t reserve;   // Alignement sur 8 octets
+};
+
+// Un catalogue binaire ouvert en lecture. Les pointeurs visent directement le fichier
+// projeté en mémoire : rien n'est copié.
+struct CatalogueMappe {
+    const char* donnees = nullptr;        // Début du fichier en mémoire
+    std::size_t taille = 0;               // Taille du fichier
+    const EnTeteCatalogue* entete = nullptr;
+    const char* tas = nullptr;
+    const EntreeLivre* table = nullptr;   // Versions 1 et 2
+    const LivreCompact* livres = nullptr; // Version 3 : table, ordre des ISBN, dictionnaires
+    const std::uint32_t* ordreIsbn = nullptr;
+    const EnTeteDictionnaires* dictionnaires = nullptr;
+    const EntreeValeur* valeurs = nullptr; // Les langues, puis les genres
+    std::vector<char> copie;              // Utilisé seulement si mmap n'est pas disponible
+};
+
+// Vérifie si le fichier commence par la signature du format binaire.
+bool estCatalogueBinaire(const std::string& filename);
+
+// Ouvre et vérifie un catalogue binaire. Retourne false si le fichier est absent,
+// d'une autre version, incohérent (tailles ou numéros qui dépassent...) ou abîmé
+// (somme de contrôle fausse). En version 3, le tas n'est pas relu ici (voir verifierTas).
+bool ouvrirCatalogueBinaire(CatalogueMappe& cat, const std::string& filename);
+
+// Libère la projection mémoire.
+void fermerCatalogueBinaire(CatalogueMappe& cat);
+
+// Remplit 'lib' depuis un catalogue binaire (nom, description et livres). En version 3,
+// le fichier reste projeté et le catalogue l'utilise directement.
+bool chargerCatalogueBinaire(Library& lib, const std::string& filename);
+
+// Vérifie la somme du tas du fichier utilisé par 'livres' (vrai s'il n'y en a pas).
+// Relit tout le texte : à faire seulement avant de le recopier ailleurs (réécriture complète),
+// pour ne pas recopier un fichier abîmé dans un fichier neuf à la somme juste.
+bool verifierTas(const CatalogueCompact& livres);
+
+// Écrit toute la bibliothèque au format binaire, par fichier temporaire renommé à la fin.
+// Retourne false en cas d'erreur d'écriture (l'ancien fichier est alors intact).
+bool sauvegarderCatalogueBinaire(const Library& lib, const std::string& filename);
+
+#endif // CATALOGUE_BIN_HPP
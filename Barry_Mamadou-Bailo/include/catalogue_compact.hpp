@@ -0,0 +1,183 @@
+/**
+ * @file catalogue_compact.hpp
+ * @brief Rangement compact des livres en mémoire (dictionnaires + arène de texte).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Un Book contient 7 std::string : 7 x 32 octets, plus une allocation pour chaque texte
+ * trop long pour tenir dans la chaîne elle-même (titre, description...). Sur plusieurs
+ * millions de livres, ces en-têtes et ces petites allocations coûtent plus que le texte.
+ *
+ * Le catalogue range donc les livres autrement :
+ *  - la langue et le genre (quelques dizaines de valeurs différentes, répétées des
+ *    millions de fois) sont remplacés par un numéro dans un dictionnaire ;
+ *  - les autres textes d'un livre sont copiés bout à bout dans une "arène" : de gros
+ *    blocs de mémoire remplis les uns après les autres, jamais déplacés ;
+ *  - chaque livre n'occupe alors que 40 octets (LivreCompact) en plus de son texte ;
+ *  - la date est aussi décodée une fois pour toutes à l'ajout, en entier AAAAMMJJ : les
+ *    filtres et les tris par date ne relisent plus jamais le texte.
+ *
+ * On lit un livre par lib.books[i], qui rend une LivreVue : des std::string_view sur
+ * l'arène, sans aucune copie. Book reste le type utilisé pour SAISIR un livre (menu,
+ * import, journal) : ajouterLivre() le copie dans le catalogue.
+ *
+ * Un catalogue chargé depuis le format binaire (version 3, voir catalogue_bin.hpp) ne
+ * recopie rien : le tableau des livres est la table du fichier projeté en mémoire, et
+ * les textes restent dans son tas. Le tableau n'est recopié qu'à la première modification.
+ */
+
+#ifndef CATALOGUE_COMPACT_HPP
+#define CATALOGUE_COMPACT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "book.hpp"
+
+// Un livre du catalogue, vu sans copie. Mêmes noms de champs que Book.
+// Les vues restent valides jusqu'à ce que le catalogue soit vidé.
+struct LivreVue {
+    std::string_view isbn, title, language, authors, date, genre, description;
+};
+
+// Vue sur un Book (valide tant que le Book existe et n'est pas modifié)
+LivreVue vueLivre(const Book& livre);
+
+// Copie d'une vue dans un Book (pour la modifier, ou la garder après un vidage)
+Book copierLivre(const LivreVue& vue);
+
+// Taille des blocs de l'arène (un texte plus grand reçoit son propre bloc)
+const std::size_t TAILLE_BLOC_ARENE = 1 << 20; // 1 Mo
+
+// Arène : les textes sont ajoutés à la suite dans le bloc courant ("bump allocation").
+// Rien n'est libéré individuellement : tout est rendu d'un coup par viderArene().
+struct ArenaTexte {
+    std::vector<std::unique_ptr<char[]>> blocs;
+    char* libre = nullptr;        // Début de la place libre dans le dernier bloc
+    std::size_t resteBloc = 0;    // Octets encore libres dans le dernier bloc
+    std::size_t octetsUtilises = 0;
+};
+
+// Réserve 'taille' octets contigus dans l'arène.
+char* reserverTexte(ArenaTexte& arene, std::size_t taille);
+
+void viderArene(ArenaTexte& arene);
+
+// Dictionnaire des valeurs répétées : texte <-> numéro. Les textes sont rangés dans l'arène
+// du catalogue, les vues de 'valeurs' ne bougent donc jamais.
+struct Dictionnaire {
+    std::vector<std::string_view> valeurs;                      // numéro -> texte
+    std::unordered_map<std::string_view, std::uint32_t> numeros; // texte -> numéro
+};
+
+// Retourne le numéro de 'valeur', en l'ajoutant au dictionnaire si elle est nouvelle.
+std::uint32_t internerValeur(Dictionnaire& dico, ArenaTexte& arene, std::string_view valeur);
+
+// Retourne le numéro de 'valeur' sans tenir compte des majuscules (ex: "roman" -> "Roman"),
+// ou -1 si elle n'est pas dans le dictionnaire. Utile pour une valeur saisie par l'utilisateur.
+long chercherValeur(const Dictionnaire& dico, std::string_view valeur);
+
+// Les textes libres d'un livre, dans l'ordre où ils sont rangés dans l'arène
+enum TexteLivre { TEXTE_ISBN, TEXTE_TITRE, TEXTE_AUTEURS, TEXTE_DATE, TEXTE_DESCRIPTION, NB_TEXTES };
+
+// Un livre rangé : 40 octets, quel que soit le nombre de lettres de ses champs.
+// C'est aussi, octet pour octet, une entrée de la table du fichier binaire : 'debut' n'est
+// donc pas un pointeur mais un décalage par rapport à CatalogueCompact::base.
+struct LivreCompact {
+    std::uint64_t debut;                  // Premier texte du livre : base + debut
+    std::uint32_t tailles[NB_TEXTES];     // Longueur de chaque texte (mis bout à bout)
+    std::uint32_t langue;                 // Numéro dans CatalogueCompact::langues
+    std::uint32_t genre;                  // Numéro dans CatalogueCompact::genres
+    std::uint32_t date;                   // AAAAMMJJ (voir dateCompacte), 0 si invalide
+};
+
+// Le tableau des livres : soit un std::vector à nous, soit la table d'un fichier binaire
+// projeté en mémoire (lecture seule). Dans ce cas, la table n'est recopiée dans 'propres'
+// qu'au premier ajout ou à la première suppression (voir catalogue_compact.cpp).
+struct TableLivres {
+    const LivreCompact* donnees = nullptr; // Premier livre (dans 'propres' ou dans le fichier)
+    std::size_t nombre = 0;
+    std::vector<LivreCompact> propres;
+
+    std::size_t size() const { return nombre; }
+    bool empty() const { return nombre == 0; }
+    const LivreCompact& operator[](std::size_t position) const { return donnees[position]; }
+    const LivreCompact* begin() const { return donnees; }
+    const LivreCompact* end() const { return donnees + nombre; }
+};
+
+struct CatalogueMappe; // Fichier binaire projeté en mémoire (voir catalogue_bin.hpp)
+
+// Les livres de la bibliothèque. En lecture, il s'utilise comme l'ancien std::vector<Book> :
+// lib.books.size(), lib.books[i].title... (chaque accès construit une LivreVue).
+// Toute modification passe par les fonctions ci-dessous (via ajouterLivre, supprimerLivre...).
+struct CatalogueCompact {
+    TableLivres livres;
+    ArenaTexte arene;
+    Dictionnaire langues;
+    Dictionnaire genres;
+
+    // Catalogue chargé du format binaire : le fichier reste projeté tant que le catalogue
+    // l'utilise, et 'base' est le début de son tas. Sinon 'base' est nul et 'debut' est
+    // directement l'adresse du texte. (Le décalage d'un texte de l'arène est calculé
+    // modulo 2^64 : base + debut retombe toujours sur la bonne adresse.)
+    std::shared_ptr<const CatalogueMappe> fichier;
+    const char* base = nullptr;
+
+    std::size_t size() const { return livres.size(); }
+    bool empty() const { return livres.empty(); }
+    LivreVue back() const { return (*this)[livres.size() - 1]; }
+
+    // Pour écrire "for (const auto& livre : lib.books)" comme avec un vector
+    struct Iterateur {
+        const CatalogueCompact* catalogue;
+        std::size_t position;
+        LivreVue operator*() const { return (*catalogue)[position]; }
+        Iterateur& operator++() { position++; return *this; }
+        bool operator!=(const Iterateur& autre) const { return position != autre.position; }
+    };
+    Iterateur begin() const { return {this, 0}; }
+    Iterateur end() const { return {this, livres.size()}; }
+
+    // Adresse du premier texte d'un livre (voir 'base')
+    const char* texte(const LivreCompact& l) const {
+        return reinterpret_cast<const char*>(static_cast<std::uintptr_t>(reinterpret_cast<std::uintptr_t>(base) + l.debut));
+    }
+
+    // Défini ici pour être "inline" : le compilateur ne calcule que les champs utilisés
+    LivreVue operator[](std::size_t position) const {
+        const LivreCompact& l = livres[position];
+        const char* p = texte(l);
+        LivreVue v;
+        v.isbn = std::string_view(p, l.tailles[TEXTE_ISBN]);               p += l.tailles[TEXTE_ISBN];
+        v.title = std::string_view(p, l.tailles[TEXTE_TITRE]);             p += l.tailles[TEXTE_TITRE];
+        v.authors = std::string_view(p, l.tailles[TEXTE_AUTEURS]);         p += l.tailles[TEXTE_AUTEURS];
+        v.date = std::string_view(p, l.tailles[TEXTE_DATE]);               p += l.tailles[TEXTE_DATE];
+        v.description = std::string_view(p, l.tailles[TEXTE_DESCRIPTION]);
+        v.language = langues.valeurs[l.langue];
+        v.genre = genres.valeurs[l.genre];
+        return v;
+    }
+};
+
+// Copie un livre à la fin du catalogue.
+void ajouterAuCatalogue(CatalogueCompact& cat, const LivreVue& livre);
+
+// Retire le livre à 'position' (les suivants reculent d'une place). Son texte reste dans
+// l'arène jusqu'au prochain vidage : une suppression est rare devant les ajouts.
+void retirerDuCatalogue(CatalogueCompact& cat, std::size_t position);
+
+// Retire d'un coup tous les livres marqués dans 'aRetirer' (un booléen par livre) : un seul
+// passage sur le tableau, les livres gardés restent dans le même ordre.
+void retirerDuCatalogue(CatalogueCompact& cat, const std::vector<bool>& aRetirer);
+
+// Vide le catalogue et rend toute la mémoire de l'arène.
+void viderCatalogue(CatalogueCompact& cat);
+
+// Prévoit la place de 'nombre' livres (évite les recopies du tableau pendant un chargement).
+void reserverCatalogue(CatalogueCompact& cat, std::size_t nombre);
+
+#endif // CATALOGUE_COMPACT_HPP
@@ -0,0 +1,67 @@
+/**
+ * @file colonnes.hpp
+ * @brief Rangement "en colonnes" de la langue, du genre et de la date, pour les filtres.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Pour filtrer par genre, par langue ou par années, parcourir le catalogue livre par livre
+ * ferait passer tout le livre (40 octets + son texte) par le cache du processeur, alors
+ * que seul un champ est regardé. On garde donc, à côté du catalogue, une colonne par champ
+ * filtrable : le i-ème élément de chaque colonne correspond au livre lib.books[i].
+ *  - langue, genre : numéro dans le dictionnaire du catalogue, sur 16 bits ;
+ *  - date          : entier AAAAMMJJ (décodé à l'ajout, voir LivreCompact), 0 si invalide.
+ *
+ * Un filtre ne compare donc plus de texte : il parcourt des tableaux d'entiers serrés,
+ * 8 livres à la fois avec les instructions SSE2 (présentes sur tous les processeurs x86-64).
+ * Comme l'index plein texte, les colonnes sont construites au premier filtre, puis tenues
+ * à jour à chaque ajout.
+ */
+
+#ifndef COLONNES_HPP
+#define COLONNES_HPP
+
+#include <cstdint>
+#include <vector>
+#include "catalogue_compact.hpp"
+
+// Numéro rangé dans les colonnes 16 bits pour tout numéro de dictionnaire >= 0xFFFF
+// (plus de 65 535 genres ou langues : le filtre revérifie alors dans le catalogue).
+const std::uint16_t NUMERO_DEBORDE = 0xFFFF;
+
+struct ColonnesLivres {
+    std::vector<std::uint16_t> langue;
+    std::vector<std::uint16_t> genre;
+    std::vector<std::uint32_t> date;   // AAAAMMJJ, 0 si la date est invalide
+
+    bool construit = false;
+};
+
+// Critères d'un filtre (tous doivent être respectés). Par défaut, tout livre passe.
+struct FiltreLivres {
+    long langue = -1;                  // Numéro dans CatalogueCompact::langues (-1 = toutes)
+    long genre = -1;                   // Numéro dans CatalogueCompact::genres (-1 = tous)
+    std::uint32_t dateMin = 0;         // Bornes incluses, au format AAAAMMJJ
+    std::uint32_t dateMax = 0xFFFFFFFF;
+};
+
+// Bornes de date pour "publié entre les années 'debut' et 'fin'" (incluses).
+void filtrerAnnees(FiltreLivres& filtre, int debut, int fin);
+
+// Ajoute un livre à la fin des colonnes (à appeler dans l'ordre des positions).
+void ajouterAuxColonnes(ColonnesLivres& colonnes, const LivreCompact& livre);
+
+// Vide les colonnes (elles seront reconstruites au prochain filtre).
+void viderColonnes(ColonnesLivres& colonnes);
+
+// Construit les colonnes à partir du catalogue (si ce n'est pas déjà fait).
+void construireColonnes(ColonnesLivres& colonnes, const CatalogueCompact& livres);
+
+// Positions des livres qui respectent le filtre, par ordre croissant (version SSE2).
+// Un numéro >= NUMERO_DEBORDE dans le filtre sélectionne tous les livres "débordés" :
+// c'est à l'appelant de les revérifier (voir filtrerLivres dans library.hpp).
+std::vector<std::uint32_t> filtrerColonnes(const ColonnesLivres& colonnes, const FiltreLivres& filtre);
+
+// Même résultat, un livre à la fois (processeurs sans SSE2, et mesure de comparaison).
+std::vector<std::uint32_t> filtrerColonnesScalaire(const ColonnesLivres& colonnes, const FiltreLivres& filtre);
+
+#endif // COLONNES_HPP
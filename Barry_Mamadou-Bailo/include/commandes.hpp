@@ -0,0 +1,33 @@
+/**
+ * @file commandes.hpp
+ * @brief Mode "commande" (sans menu) : import, export, recherche et statistiques en une ligne.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Pour les scripts et les chaînes de traitement, l'application peut être lancée avec une
+ * commande au lieu d'ouvrir le menu :
+ *
+ *   ./app import livres.csv [--threads N]
+ *   ./app export-html catalogue.html            (un seul fichier)
+ *   ./app export-html catalogue/ [--per-page N]  (un dossier, une page par lettre)
+ *   ./app search --title X | --isbn X | --publisher X | --text "requête"
+ *                | --genre G --language L --from AAAA --to AAAA   [--json] [--limit N]
+ *   ./app stats [--json]
+ *
+ * Option commune : --db fichier (library.db par défaut).
+ *
+ * Ces commandes réutilisent les mêmes fonctions que le menu (importerReferences,
+ * exporterHTML, index et curseurs de recherche), mais n'effacent jamais l'écran,
+ * n'utilisent pas de couleurs et n'attendent aucune saisie : la sortie est faite pour
+ * être lue par un autre programme (une ligne CSV par livre, ou du JSON).
+ * Code de retour : 0 si tout va bien, 1 en cas d'erreur, 2 si la commande est mal écrite.
+ */
+
+#ifndef COMMANDES_HPP
+#define COMMANDES_HPP
+
+// Exécute la commande décrite par les arguments du programme (argv[1] = nom de la commande).
+// Retourne le code de sortie du programme.
+int executerCommande(int argc, char* argv[]);
+
+#endif // COMMANDES_HPP
@@ -18,6 +18,9 @@
 // Cela permet de passer une seule variable 'config' aux fonctions au lieu de plusieurs.
 struct AppConfig {
     int livresParPage = 5;       // Valeur par défaut si aucun fichier de config n'est trouvé
+    int threadsImport = 0;       // Threads pour l'import CSV (0 = automatique selon le processeur)
+    bool mesures = false;        // Statistiques de performance relevées (voir mesures.hpp)
+    bool mesuresEnFichier = false; // Rapport des statistiques écrit dans mesures.txt en quittant
     std::string logo;            // Le dessin (logo ASCII) affiché en haut du menu
 };
 
@@ -0,0 +1,78 @@
+/**
+ * @file csv.hpp
+ * @brief Lecture rapide de fichiers CSV (séparateur ';') sans allocation par champ.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * L'ancien découpage créait un std::istringstream et un std::string par champ et par ligne.
+ * Ici, le fichier est lu par gros blocs dans un tampon réutilisé, et chaque champ est une
+ * simple vue (std::string_view) sur ce tampon. On ne copie qu'au moment de remplir le Book.
+ *
+ * Les guillemets suivent la RFC 4180 :
+ *   - un champ qui commence par " peut contenir des ';' et des sauts de ligne ;
+ *   - "" à l'intérieur d'un tel champ représente un seul guillemet.
+ * Un " au milieu d'un champ non protégé est gardé tel quel (tolérance pour les vieux fichiers).
+ * Les library.db écrits avant les guillemets (sans en-tête #BIBLIO) se lisent sans eux :
+ * le lecteur ouvert avec guillemets = false coupe seulement aux ';' et aux fins de ligne.
+ */
+
+#ifndef CSV_HPP
+#define CSV_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "tampon_sortie.hpp"
+
+// Taille initiale du tampon de lecture (agrandi automatiquement si un enregistrement est plus long)
+const std::size_t TAILLE_TAMPON_CSV = 1 << 20; // 1 Mo
+
+// Cherche la fin de l'enregistrement qui commence à 'debut' (en tenant compte des guillemets).
+// Retourne un pointeur sur le '\n' final, 'fin' si les données s'arrêtent sans '\n' alors que
+// 'finDeFlux' est vrai, ou nullptr si l'enregistrement est incomplet (il faut lire la suite).
+const char* trouverFinEnregistrement(const char* debut, const char* fin, char separateur, bool finDeFlux);
+
+// Position juste après le dernier enregistrement complet de [debut, fin) (0 s'il n'y en a aucun).
+// Sert à découper un gros bloc lu dans le fichier sans couper une ligne (ni un champ entre guillemets).
+std::size_t derniereFinEnregistrement(const char* debut, const char* fin, char separateur);
+
+// Découpe un enregistrement COMPLET [debut, fin) (sans le '\n' final) en champs.
+// Les guillemets doublés sont réécrits sur place : la zone doit donc être modifiable.
+// Les vues de 'champs' restent valides tant que la zone n'est pas modifiée.
+void decouperEnregistrement(char* debut, char* fin, char separateur, std::vector<std::string_view>& champs);
+
+// Lecteur CSV en flux : lit le fichier par blocs et rend les enregistrements un par un.
+struct LecteurCSV {
+    std::istream* flux = nullptr;
+    char separateur = ';';
+    std::vector<char> tampon;   // Tampon de lecture, réutilisé d'un bloc à l'autre
+    std::size_t debut = 0;      // Début des données non encore consommées
+    std::size_t fin = 0;        // Fin des données valides dans le tampon
+    bool finDeFlux = false;     // Plus rien à lire dans le fichier
+    std::uint64_t decalage = 0; // Octets du flux déjà sortis du tampon (pour positionLecteurCSV)
+    bool guillemets = true;     // false : les " sont du texte comme les autres (anciens fichiers)
+};
+
+// Prépare un lecteur sur un flux déjà ouvert (la lecture reprend à la position courante du flux).
+// Avec guillemets = false, un champ n'est jamais protégé : chaque ligne est un enregistrement.
+void ouvrirLecteurCSV(LecteurCSV& lecteur, std::istream& flux, char separateur = ';', bool guillemets = true);
+
+// Lit l'enregistrement suivant. Retourne false à la fin du fichier.
+// Les vues de 'champs' ne sont valides que jusqu'au prochain appel.
+bool lireEnregistrement(LecteurCSV& lecteur, std::vector<std::string_view>& champs);
+
+// Position dans le flux (en octets depuis l'ouverture du lecteur) juste après le dernier
+// enregistrement rendu par lireEnregistrement.
+std::uint64_t positionLecteurCSV(const LecteurCSV& lecteur);
+
+// Écrit un champ en ajoutant les guillemets RFC 4180 seulement si c'est nécessaire.
+void ecrireChampCSV(std::ostream& sortie, std::string_view champ, char separateur = ';');
+
+// Même chose dans un tampon de sortie : un champ sans caractère spécial part en un seul bloc.
+void ecrireChampCSV(TamponSortie& sortie, std::string_view champ, char separateur = ';');
+
+#endif // CSV_HPP
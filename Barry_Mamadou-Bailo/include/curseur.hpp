@@ -0,0 +1,44 @@
+/**
+ * @file curseur.hpp
+ * @brief Curseur de recherche : les résultats sont cherchés au fur et à mesure de l'affichage.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Une recherche par titre ou par code éditeur doit lire les livres un par un. Plutôt que de
+ * parcourir tout le catalogue avant d'afficher quoi que ce soit, le curseur s'arrête dès
+ * qu'il a trouvé assez de livres pour la page demandée, et reprend là où il s'était arrêté
+ * quand l'utilisateur passe à la page suivante. La première page s'affiche donc aussi vite
+ * sur 10 millions de livres que sur mille (tant que les résultats ne sont pas rarissimes).
+ * Le nombre total de résultats n'est connu qu'une fois le catalogue entièrement parcouru.
+ */
+
+#ifndef CURSEUR_HPP
+#define CURSEUR_HPP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "catalogue_compact.hpp"
+
+struct CurseurRecherche {
+    const CatalogueCompact* livres = nullptr;
+    std::function<bool(const LivreVue&)> correspond; // Le livre fait-il partie des résultats ?
+    std::size_t prochain = 0;                        // Prochain livre du catalogue à examiner
+    std::vector<std::uint32_t> trouves;              // Positions trouvées jusqu'ici (croissantes)
+};
+
+// Prépare un curseur sur 'livres' (rien n'est encore parcouru).
+CurseurRecherche ouvrirCurseur(const CatalogueCompact& livres, std::function<bool(const LivreVue&)> correspond);
+
+// Curseur déjà au bout, avec ses résultats (positions croissantes) : pour une recherche
+// qui trouve tout d'un coup dans un index, affichée comme les autres.
+CurseurRecherche curseurResultats(const CatalogueCompact& livres, std::vector<std::uint32_t> positions);
+
+// Parcourt le catalogue jusqu'à avoir au moins 'nombre' résultats, ou jusqu'à la fin.
+// Retourne le nombre de résultats disponibles.
+std::size_t avancerCurseur(CurseurRecherche& curseur, std::size_t nombre);
+
+// Vrai quand tout le catalogue a été parcouru (le nombre de résultats est alors définitif).
+bool curseurTermine(const CurseurRecherche& curseur);
+
+#endif // CURSEUR_HPP
@@ -0,0 +1,38 @@
+/**
+ * @file ecran.hpp
+ * @brief Rendu des menus par écran entier : un seul envoi au terminal par écran.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Les menus écrivent beaucoup de petits morceaux dans std::cout, presque toujours terminés
+ * par std::endl, qui vide le flux : chaque page du catalogue coûtait des dizaines d'appels
+ * système, et par SSH l'écran se redessinait par à-coups (effacé, puis rempli ligne à ligne).
+ *
+ * Une fois installerRenduEcran() appelé, tout ce qui est écrit dans std::cout s'accumule
+ * dans un tampon (réutilisé d'un écran à l'autre) et std::endl ne vide plus rien. L'écran
+ * part en un seul 'write' juste avant que le programme attende une saisie (std::cin), avant
+ * un message d'erreur (std::cerr) et à la fin du programme.
+ *
+ * De plus, quand un nouvel écran commence par les mêmes lignes que le précédent (le logo,
+ * le titre, l'en-tête de la liste en passant d'une page à l'autre...), ces lignes ne sont
+ * pas renvoyées : le curseur est placé juste en dessous et seule la suite est redessinée.
+ * Cela n'est fait que si le terminal est assez grand pour que l'écran précédent n'ait pas
+ * défilé (sinon les lignes ne sont plus à la même place) ; sinon l'écran est effacé et
+ * entièrement redessiné, comme avant.
+ */
+
+#ifndef ECRAN_HPP
+#define ECRAN_HPP
+
+// Redirige std::cout vers le tampon d'écran (mode menu uniquement : le mode commande
+// écrit dans un fichier ou un tube, où l'écriture par blocs habituelle convient).
+void installerRenduEcran();
+
+// Début d'un nouvel écran (appelé par clearScreen) : l'effacement n'est décidé qu'à l'envoi.
+// Sans rendu installé, efface directement le terminal.
+void effacerEcran();
+
+// Envoie tout de suite ce qui est en attente (ex: "Importation en cours..." avant un long import).
+void envoyerEcran();
+
+#endif // ECRAN_HPP
@@ -0,0 +1,58 @@
+/**
+ * @file export_html.hpp
+ * @brief Tri des livres par titre et génération du catalogue HTML.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Le tri ne copie ni les livres ni leurs titres : on trie un simple tableau de
+ * positions (8 octets par livre). La clé de tri (titre sans article, en majuscules)
+ * n'est jamais construite : on retient seulement la longueur de l'article à ignorer,
+ * et la comparaison met les lettres en majuscules au fil de l'eau.
+ */
+
+#ifndef EXPORT_HTML_HPP
+#define EXPORT_HTML_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "library.hpp"
+
+// Un livre dans l'ordre de tri
+struct CleTri {
+    std::uint32_t position;   // Position du livre dans Library::books
+    std::uint32_t debutCle;   // Longueur de l'article ignoré ("Le ", "L'"...), 0 s'il n'y en a pas
+};
+
+// Clé de tri d'un titre : en majuscules, sans article initial ("Le", "La", "L'"...).
+std::string nettoyerTitrePourTri(std::string_view titre);
+
+// Retourne les livres triés par clé ; à clé égale, l'ordre du catalogue est conservé.
+std::vector<CleTri> trierParTitre(const Library& lib);
+
+// Lettre de la section d'un livre trié ('A' à 'Z', ou '#' pour le reste).
+char lettreSection(const Library& lib, const CleTri& livre);
+
+// --- EXPORT EN PLUSIEURS FICHIERS ---
+// Un catalogue de plusieurs millions de livres donne un seul fichier de plusieurs centaines
+// de Mo, qu'aucun navigateur n'ouvre. On peut donc aussi écrire un dossier contenant :
+//   - index.html : la barre alphabétique et, pour chaque lettre, les liens vers ses pages ;
+//   - lettre-A-1.html, lettre-A-2.html... : les livres de la lettre, 'livresParPage' par fichier
+//     (la section '#' donne lettre-autres-1.html...).
+
+// Ordre des sections (barre d'index)
+const std::string ALPHABET_SECTIONS = "#ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+// Taille de page par défaut de l'export en plusieurs fichiers
+const int LIVRES_PAR_PAGE_HTML = 500;
+
+// Nom du fichier de la page 'page' (à partir de 1) de la section 'lettre'.
+std::string nomFichierPage(char lettre, int page);
+
+// Écrit le catalogue dans 'dossier' (créé si besoin). Les pages sont écrites en parallèle
+// sur 'nbThreads' threads (0 = autant que de cœurs).
+// Retourne le nombre de fichiers écrits (index compris), ou -1 en cas d'erreur.
+int exporterHTMLParLettre(const Library& lib, const std::string& dossier, int livresParPage, int nbThreads = 0);
+
+#endif // EXPORT_HTML_HPP
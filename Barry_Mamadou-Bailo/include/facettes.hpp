@@ -0,0 +1,83 @@
+/**
+ * @file facettes.hpp
+ * @brief Parcours par facettes : genre, langue et décennie de parution, avec leurs comptes.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * L'écran "Parcourir" laisse choisir un genre, puis une langue, puis une décennie (dans
+ * n'importe quel ordre), en montrant à chaque fois combien de livres il reste pour chaque
+ * valeur. Refaire un filtre sur tout le catalogue pour chaque valeur proposée serait lent.
+ *
+ * L'index garde donc, pour chaque valeur de chaque facette, l'ensemble de ses livres sous
+ * forme de bitmap compressé (voir bitmap_compresse.hpp) :
+ *  - les livres d'une sélection (ex: Roman ET FR ET 1950-1959) sont le ET des ensembles ;
+ *  - le nombre de livres de chaque genre dans cette sélection est compté par un ET
+ *    sans rien construire, bloc par bloc.
+ * Aucun livre du catalogue n'est relu.
+ *
+ * Comme les colonnes des filtres, l'index n'est construit qu'au premier parcours, puis
+ * tenu à jour à chaque ajout (les livres arrivent toujours à la fin du catalogue).
+ */
+
+#ifndef FACETTES_HPP
+#define FACETTES_HPP
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "bitmap_compresse.hpp"
+#include "catalogue_compact.hpp"
+
+enum Facette { FACETTE_GENRE, FACETTE_LANGUE, FACETTE_DECENNIE, NB_FACETTES };
+
+// "Décennie" des livres sans date valide (rangée après toutes les autres)
+const long DECENNIE_INCONNUE = 100000;
+
+struct IndexFacettes {
+    std::vector<BitmapCompresse> genres;        // Numéro de genre (CatalogueCompact::genres) -> livres
+    std::vector<BitmapCompresse> langues;       // Numéro de langue -> livres
+    std::map<long, BitmapCompresse> decennies;  // Première année (ex: 1950) -> livres de 1950 à 1959
+    std::uint32_t nombreLivres = 0;             // Livres indexés (tout le catalogue)
+
+    bool construit = false;
+};
+
+// Choix en cours : une valeur par facette (numéro de genre / de langue, première année de
+// la décennie), -1 = pas de choix pour cette facette.
+struct SelectionFacettes {
+    long choix[NB_FACETTES] = {-1, -1, -1};
+};
+
+// Nombre de livres d'une valeur de facette
+struct CompteFacette {
+    long valeur;
+    std::uint32_t livres;
+};
+
+// Décennie d'une date AAAAMMJJ (ex: 19540312 -> 1950), DECENNIE_INCONNUE si la date vaut 0.
+long decennieDe(std::uint32_t date);
+
+// Ajoute un livre à la fin de l'index (à appeler dans l'ordre des positions).
+void indexerFacettes(IndexFacettes& index, std::uint32_t position, const LivreCompact& livre);
+
+// Vide l'index (il sera reconstruit au prochain parcours).
+void viderIndexFacettes(IndexFacettes& index);
+
+// Construit l'index à partir du catalogue (si ce n'est pas déjà fait).
+void construireIndexFacettes(IndexFacettes& index, const CatalogueCompact& livres);
+
+// Vrai si aucune facette n'est choisie (la sélection est alors tout le catalogue).
+bool selectionVide(const SelectionFacettes& selection);
+
+// Nombre de livres pour chaque valeur de 'facette', parmi les livres qui respectent les
+// choix des AUTRES facettes. Seules les valeurs ayant des livres sont gardées : les plus
+// fréquentes d'abord pour le genre et la langue, dans l'ordre chronologique pour la décennie.
+std::vector<CompteFacette> compterFacette(const IndexFacettes& index, const SelectionFacettes& selection, Facette facette);
+
+// Nombre de livres qui respectent tous les choix de la sélection.
+std::uint32_t compterSelection(const IndexFacettes& index, const SelectionFacettes& selection);
+
+// Positions (croissantes) des livres qui respectent tous les choix de la sélection.
+std::vector<std::uint32_t> livresSelection(const IndexFacettes& index, const SelectionFacettes& selection);
+
+#endif // FACETTES_HPP
@@ -0,0 +1,72 @@
+/**
+ * @file fichier_atomique.hpp
+ * @brief Écriture "tout ou rien" d'un fichier, avec somme de contrôle.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Ouvrir directement library.db avec std::ofstream le vide immédiatement : un arrêt
+ * brutal (ou un disque plein) pendant l'écriture détruisait tout le catalogue.
+ * Ici, on écrit dans un fichier temporaire à côté de la cible ('cible.tmp'), on force
+ * son écriture sur le disque (fsync), puis on le renomme par-dessus la cible. Le
+ * renommage est atomique : après un arrêt, on trouve soit l'ancien fichier complet,
+ * soit le nouveau complet, jamais un mélange des deux.
+ *
+ * Pendant l'écriture, une somme de contrôle 64 bits (même algorithme que xxHash64) est
+ * calculée sur les données au moment où chaque bloc du tampon part vers le fichier.
+ * Elle est rangée dans le fichier pour que le chargement puisse refuser un fichier
+ * tronqué ou abîmé. Elle traite 32 octets par tour : son coût est négligeable
+ * devant celui de l'écriture.
+ */
+
+#ifndef FICHIER_ATOMIQUE_HPP
+#define FICHIER_ATOMIQUE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "tampon_sortie.hpp"
+
+// Somme de contrôle calculée au fil de l'eau (les données peuvent arriver par morceaux)
+struct SommeControle {
+    std::uint64_t accumulateurs[4];
+    std::uint64_t total = 0;          // Nombre d'octets déjà reçus
+    unsigned char reste[32];          // Octets en attente d'un bloc complet de 32
+    std::size_t tailleReste = 0;
+};
+
+void initialiserSomme(SommeControle& s);
+void ajouterSomme(SommeControle& s, const char* donnees, std::size_t taille);
+std::uint64_t valeurSomme(const SommeControle& s);
+
+// Somme de contrôle d'un fichier entier, ou de ses 'taille' premiers octets.
+// Retourne false si le fichier ne peut pas être lu jusque-là.
+bool sommeFichier(const std::string& chemin, std::uint64_t taille, std::uint64_t& somme);
+
+// Un fichier en cours d'écriture. On écrit avec ecrire(f.tampon, ...) : chaque bloc du
+// tampon est ajouté à 'somme' quand il part vers le fichier temporaire.
+struct FichierAtomique {
+    std::string cible;
+    std::string temporaire;     // cible + ".tmp", dans le même dossier (le renommage l'exige)
+    std::ofstream flux;
+    TamponSortie tampon;
+    SommeControle somme;
+};
+
+// Crée le fichier temporaire. Retourne false s'il ne peut pas être créé.
+bool ouvrirFichierAtomique(FichierAtomique& f, const std::string& cible);
+
+// Vide le tampon, force l'écriture sur le disque puis remplace la cible.
+// En cas d'erreur, le temporaire est supprimé et la cible n'a pas été touchée.
+bool validerFichierAtomique(FichierAtomique& f);
+
+// Abandonne l'écriture : le temporaire est supprimé, la cible reste intacte.
+void abandonnerFichierAtomique(FichierAtomique& f);
+
+// Remplace 'cible' par 'contenu' avec la même méthode (pour les petits fichiers).
+bool ecrireFichierAtomique(const std::string& cible, const std::string& contenu);
+
+// Force l'écriture sur le disque d'un fichier déjà fermé (fsync). Sans effet sous Windows.
+bool synchroniserFichier(const std::string& chemin);
+
+#endif // FICHIER_ATOMIQUE_HPP
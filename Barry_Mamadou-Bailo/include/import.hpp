@@ -0,0 +1,51 @@
+/**
+ * @file import.hpp
+ * @brief Import CSV en parallèle (lecture, analyse et fusion sur plusieurs threads).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Pour les très gros fichiers, un seul cœur ne suffit plus : le découpage des lignes et
+ * la copie des champs coûtent plus cher que la lecture du disque. L'import est donc
+ * organisé en "chaîne de montage" :
+ *
+ *   1. un thread LECTEUR lit le fichier par gros blocs, coupés sur une fin d'enregistrement ;
+ *   2. plusieurs OUVRIERS découpent et valident les blocs en même temps (un bloc chacun) ;
+ *   3. le thread appelant FUSIONNE les blocs dans l'ordre du fichier : c'est lui seul qui
+ *      vérifie les doublons d'ISBN et ajoute les livres dans la bibliothèque.
+ *
+ * Comme la fusion suit l'ordre du fichier, le résultat est exactement le même qu'avec
+ * un import séquentiel, quel que soit le nombre de threads.
+ */
+
+#ifndef IMPORT_HPP
+#define IMPORT_HPP
+
+#include <istream>
+#include <string_view>
+#include <vector>
+#include "library.hpp"
+
+// Taille d'un bloc lu par le thread lecteur
+const std::size_t TAILLE_BLOC_IMPORT = 4 << 20; // 4 Mo
+
+// Nombre maximum de blocs en mémoire par thread ouvrier (lus mais pas encore fusionnés).
+// Sans cette limite, un lecteur plus rapide que la fusion chargerait tout le fichier en mémoire.
+const int BLOCS_EN_VOL_PAR_OUVRIER = 2;
+
+// Remplit un livre à partir des champs d'une ligne CSV (ordre : ISBN;Titre;Langue;Auteurs;Date;Genre;Description).
+// C'est la seule copie des données : les champs sont des vues sur le tampon de lecture.
+// Retourne false si la ligne n'a pas au moins 6 colonnes (livre invalide).
+bool remplirLivre(Book& b, const std::vector<std::string_view>& champs);
+
+// Même chose sans aucune copie : la vue pointe sur les champs (valide jusqu'à la ligne suivante).
+bool remplirLivre(LivreVue& b, const std::vector<std::string_view>& champs);
+
+// Nombre de threads réellement utilisés pour une demande donnée (0 = automatique, selon le processeur).
+int nombreThreadsImport(int demande);
+
+// Importe les livres d'un flux CSV (la ligne d'en-tête est ignorée) avec 'nbThreads' ouvriers.
+// Avec 1 thread, tout est fait sur le thread appelant (aucun thread créé).
+// 'rapport.lignes' est incrémenté du nombre d'enregistrements lus ; retourne le nombre de livres ajoutés.
+int importerCSV(Library& lib, std::istream& fichier, int nbThreads, RapportImport& rapport);
+
+#endif // IMPORT_HPP
@@ -0,0 +1,75 @@
+/**
+ * @file index_approche.hpp
+ * @brief Recherche approchée (fautes de frappe tolérées) sur les titres et les auteurs.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * "Baudlaire" ou "baudelère" doivent trouver Baudelaire. Comparer la requête à chaque mot
+ * de chaque livre (distance d'édition) serait bien trop lent sur des millions de livres.
+ *
+ * On garde donc le vocabulaire des titres et des auteurs : chaque mot normalisé (minuscules,
+ * sans accents, voir normaliserTexte) n'y est qu'une fois, avec la liste de ses livres.
+ * Pour chaque trigramme (3 octets qui se suivent, le début et la fin du mot comptant comme
+ * un caractère : "hugo" -> "^hu", "hug", "ugo", "go$"), l'index garde les mots qui le
+ * contiennent. Pour chercher un mot :
+ *  1. ses trigrammes donnent les mots du vocabulaire qui en partagent assez (une faute
+ *     ne change que 4 trigrammes au plus) : les autres mots ne sont même pas regardés ;
+ *  2. les candidats dont trop de lettres diffèrent sont écartés (un masque de 32 bits par
+ *     mot : une faute n'ajoute ou n'enlève qu'une lettre) ;
+ *  3. seuls les candidats restants sont comparés au mot cherché (distance de Levenshtein : nombre
+ *     de lettres à insérer, supprimer ou remplacer, deux lettres voisines inversées
+ *     comptant pour une faute), jusqu'à 1 faute pour un mot de 4 à 7 lettres, 2 au-delà,
+ *     aucune en dessous ;
+ *  4. les livres des mots retenus sont réunis, un mot exact comptant plus qu'un mot à une
+ *     faute, et un titre plus qu'un auteur.
+ * Avec plusieurs mots, un livre doit correspondre à tous (comme la recherche plein texte).
+ *
+ * Comme l'index plein texte, il n'est construit qu'à la première recherche approchée,
+ * puis tenu à jour à chaque ajout de livre.
+ */
+
+#ifndef INDEX_APPROCHE_HPP
+#define INDEX_APPROCHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "catalogue_compact.hpp"
+#include "index_texte.hpp" // Pour Occurrence et les poids des champs
+
+struct IndexApproche {
+    std::vector<std::string> mots;                           // Numéro -> mot normalisé
+    std::unordered_map<std::string, std::uint32_t> numeros;  // Mot -> numéro
+    std::vector<std::vector<Occurrence>> livres;             // Numéro du mot -> livres (positions croissantes)
+    std::vector<std::uint32_t> lettres;                      // Numéro du mot -> lettres présentes (voir masqueLettres)
+
+    // Trigramme (3 octets rangés dans un entier) -> numéros des mots qui le contiennent (croissants)
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> trigrammes;
+
+    bool construit = false;
+};
+
+// Ajoute les mots du titre et des auteurs d'un livre. Les livres doivent être ajoutés dans
+// l'ordre de leur position.
+void indexerApproche(IndexApproche& index, std::uint32_t position, const LivreVue& livre);
+
+// Vide l'index (il sera reconstruit à la prochaine recherche approchée).
+void viderIndexApproche(IndexApproche& index);
+
+// Construit l'index complet à partir du catalogue (si ce n'est pas déjà fait).
+void construireIndexApproche(IndexApproche& index, const CatalogueCompact& livres);
+
+// Nombre de fautes tolérées pour un mot de cette longueur (en octets, une fois normalisé)
+int fautesTolerees(std::size_t longueur);
+
+// Distance d'édition entre 'a' et 'b' (Levenshtein, plus l'inversion de deux lettres voisines),
+// ou 'maximum' + 1 dès qu'elle le dépasse
+int distanceEdition(std::string_view a, std::string_view b, int maximum);
+
+// Livres dont le titre ou les auteurs contiennent chaque mot de la requête, à quelques
+// fautes près, du plus proche au moins proche (puis dans l'ordre du catalogue).
+std::vector<std::uint32_t> rechercherApproche(const IndexApproche& index, const std::string& requete);
+
+#endif // INDEX_APPROCHE_HPP
@@ -0,0 +1,64 @@
+/**
+ * @file index_dates.hpp
+ * @brief Index trié des dates de parution (tri par date, livres publiés entre deux dates).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Les livres sont rangés dans l'ordre où ils ont été ajoutés, pas par date. L'index garde
+ * donc un tableau de couples (date AAAAMMJJ, position du livre) trié par date :
+ *  - "trier par date" revient à le parcourir dans l'ordre ;
+ *  - "publiés entre X et Y" revient à deux recherches dichotomiques (std::lower_bound /
+ *    std::upper_bound) : les livres trouvés sont tous côte à côte, entre les deux bornes.
+ *    Le temps de recherche est logarithmique, sans parcourir le catalogue.
+ *
+ * Comme l'index plein texte, il n'est construit qu'à la première question. Ensuite, les
+ * livres ajoutés attendent dans une petite liste, triée et fusionnée avec l'index à la
+ * question suivante (un seul tri pour tout un import, au lieu d'une insertion par livre).
+ */
+
+#ifndef INDEX_DATES_HPP
+#define INDEX_DATES_HPP
+
+#include <cstdint>
+#include <vector>
+#include "catalogue_compact.hpp"
+
+// Un livre dans l'index des dates
+struct EntreeDate {
+    std::uint32_t date;    // AAAAMMJJ, 0 si la date du livre est invalide
+    std::uint32_t livre;   // Position du livre dans Library::books
+};
+
+struct IndexDates {
+    std::vector<EntreeDate> tries;      // Triés par date, puis par position
+    std::vector<EntreeDate> enAttente;  // Ajoutés depuis la dernière question (pas encore triés)
+    bool construit = false;
+};
+
+// Les entrées [debut, fin) de l'index : des livres consécutifs dans l'ordre des dates.
+// Elles restent valides jusqu'au prochain ajout ou à la prochaine question.
+struct TrancheDates {
+    const EntreeDate* debut = nullptr;
+    const EntreeDate* fin = nullptr;
+
+    std::size_t size() const { return static_cast<std::size_t>(fin - debut); }
+    bool empty() const { return debut == fin; }
+};
+
+// Ajoute un livre à l'index (s'il est construit, sinon il sera pris à la construction).
+void indexerDate(IndexDates& index, std::uint32_t position, std::uint32_t date);
+
+// Vide l'index (il sera reconstruit à la prochaine question).
+void viderIndexDates(IndexDates& index);
+
+// Construit l'index à partir du catalogue si nécessaire, et y range les livres en attente.
+void preparerIndexDates(IndexDates& index, const CatalogueCompact& livres);
+
+// Livres publiés entre 'dateMin' et 'dateMax' (AAAAMMJJ, incluses), du plus ancien au plus
+// récent. L'index doit être prêt (preparerIndexDates).
+TrancheDates chercherEntreDates(const IndexDates& index, std::uint32_t dateMin, std::uint32_t dateMax);
+
+// Tous les livres ayant une date valide, du plus ancien au plus récent.
+TrancheDates livresDates(const IndexDates& index);
+
+#endif // INDEX_DATES_HPP
@@ -0,0 +1,82 @@
+/**
+ * @file index_editeurs.hpp
+ * @brief Index des éditeurs, tiré de la structure de l'ISBN (recherche "Par Code Éditeur").
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Un ISBN-13 se découpe en cinq parties : 978-2-07-036822-8
+ *  - le préfixe EAN (978 ou 979) ;
+ *  - le groupe (pays ou langue, ici 2 : francophone), de 1 à 5 chiffres ;
+ *  - l'éditeur (ici 07 : Gallimard), de 1 à 7 chiffres ;
+ *  - la publication (le livre chez cet éditeur), puis la clé de contrôle.
+ *
+ * Avant, la recherche par code éditeur cherchait "-CODE-" dans chaque ISBN : tout le
+ * catalogue était relu, et un ISBN écrit sans tirets (9782070368228) n'était jamais trouvé.
+ *
+ * Ici, chaque ISBN est découpé une fois, et l'index garde des couples (clé, position du
+ * livre) triés par clé, la clé rassemblant préfixe, groupe et éditeur dans un entier.
+ * Les livres d'un éditeur sont donc côte à côte, trouvés par deux recherches dichotomiques.
+ *  - Avec tirets, les parties sont lues entre les tirets (ISBN-13, ou ISBN-10 : préfixe 978).
+ *  - Sans tirets, les longueurs du groupe et de l'éditeur dépendent des numéros : elles sont
+ *    lues dans la table des tranches de l'agence internationale de l'ISBN. Seuls les groupes
+ *    les plus courants y sont recopiés (voir index_editeurs.cpp).
+ * Les ISBN qui ne se découpent pas (autre forme, groupe absent de la table) sont gardés à
+ * part et comparés comme avant ("-CODE-" dans l'ISBN) : ils sont rares dans un vrai catalogue.
+ *
+ * Comme l'index des dates, il n'est construit qu'à la première recherche, puis les livres
+ * ajoutés attendent dans une petite liste triée et fusionnée à la recherche suivante.
+ */
+
+#ifndef INDEX_EDITEURS_HPP
+#define INDEX_EDITEURS_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "catalogue_compact.hpp"
+
+// Préfixe, groupe et éditeur d'un ISBN. Les zéros de tête comptent ("07" n'est pas "7") :
+// chaque numéro est gardé avec son nombre de chiffres.
+struct StructureIsbn {
+    bool prefixe979 = false;         // Préfixe EAN 979 (sinon 978)
+    std::uint32_t groupe = 0;
+    int chiffresGroupe = 0;          // 1 à 5
+    std::uint32_t editeur = 0;
+    int chiffresEditeur = 0;         // 1 à 7
+};
+
+// Découpe un ISBN-13 ou ISBN-10, avec ou sans tirets (ou espaces). Retourne false s'il n'a
+// pas cette forme, ou si, sans tirets, son groupe n'est pas dans la table des tranches.
+bool decouperIsbn(std::string_view isbn, StructureIsbn& structure);
+
+// Un livre dans l'index des éditeurs
+struct EntreeEditeur {
+    std::uint64_t cle;      // Préfixe, groupe et éditeur (voir cleEditeur dans index_editeurs.cpp)
+    std::uint32_t livre;    // Position du livre dans Library::books
+};
+
+struct IndexEditeurs {
+    std::vector<EntreeEditeur> tries;       // Triés par clé, puis par position
+    std::vector<EntreeEditeur> enAttente;   // Ajoutés depuis la dernière recherche (pas encore triés)
+    std::vector<std::uint32_t> nonDecoupes; // Livres dont l'ISBN ne se découpe pas (positions croissantes)
+    bool construit = false;
+};
+
+// Ajoute un livre à l'index (s'il est construit, sinon il sera pris à la construction).
+void indexerEditeur(IndexEditeurs& index, std::uint32_t position, std::string_view isbn);
+
+// Vide l'index (il sera reconstruit à la prochaine recherche).
+void viderIndexEditeurs(IndexEditeurs& index);
+
+// Construit l'index à partir du catalogue si nécessaire, et y range les livres en attente.
+void preparerIndexEditeurs(IndexEditeurs& index, const CatalogueCompact& livres);
+
+// Livres d'un éditeur, par position croissante. 'code' peut être :
+//  - "07"       : l'éditeur 07, quel que soit le groupe (une recherche par groupe présent) ;
+//  - "2-07"     : l'éditeur 07 du groupe 2 ;
+//  - "978-2-07" : avec le préfixe.
+// L'index doit être prêt (preparerIndexEditeurs).
+std::vector<std::uint32_t> chercherEditeur(const IndexEditeurs& index, const CatalogueCompact& livres, std::string_view code);
+
+#endif // INDEX_EDITEURS_HPP
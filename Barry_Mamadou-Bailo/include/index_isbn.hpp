@@ -0,0 +1,54 @@
+/**
+ * @file index_isbn.hpp
+ * @brief Index des ISBN (vérification des doublons, recherche exacte par ISBN).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Chaque ajout de livre vérifie que son ISBN n'existe pas déjà : sans index, il fallait
+ * parcourir tout le catalogue. L'index a deux parties :
+ *  - pour un catalogue chargé du format binaire, l'ordre des livres par ISBN est rangé
+ *    dans le fichier (voir catalogue_bin.hpp) : une recherche dichotomique dans cette
+ *    table suffit, rien n'est construit au démarrage ;
+ *  - pour les autres livres (ajoutés ensuite, ou tout le catalogue s'il vient du format
+ *    texte), une table de hachage ISBN normalisé -> position, construite à la première
+ *    recherche puis tenue à jour à chaque ajout (comme les autres index).
+ */
+
+#ifndef INDEX_ISBN_HPP
+#define INDEX_ISBN_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include "catalogue_compact.hpp"
+
+// Met un ISBN sous une forme canonique (sans tirets ni espaces, en majuscules).
+// Ainsi "978-2-07-036822-8" et "9782070368228" sont considérés comme le même livre.
+std::string normaliserIsbn(std::string_view isbn);
+
+struct IndexIsbn {
+    // Livres [0, nbFichier) : leurs positions triées par ISBN (puis par position), lues dans
+    // le fichier binaire projeté. Vidé avec le catalogue, ou dès que les positions changent.
+    const std::uint32_t* ordreFichier = nullptr;
+    std::uint32_t nbFichier = 0;
+
+    // Livres suivants : ISBN normalisé -> position (en cas de doublon, le premier gagne)
+    std::unordered_map<std::string, std::uint32_t> positions;
+    bool construit = false;
+};
+
+// Utilise l'ordre des ISBN du fichier pour les 'nombre' premiers livres (juste après le
+// chargement, index vide).
+void utiliserOrdreFichier(IndexIsbn& index, const std::uint32_t* ordre, std::uint32_t nombre);
+
+// Ajoute un livre à l'index (s'il est construit, sinon il sera pris à la construction).
+void indexerIsbn(IndexIsbn& index, std::uint32_t position, std::string_view isbn);
+
+// Vide l'index (il sera reconstruit à la prochaine recherche).
+void viderIndexIsbn(IndexIsbn& index);
+
+// Position du premier livre ayant cet ISBN, ou -1. Construit l'index si nécessaire.
+long chercherIsbn(IndexIsbn& index, const CatalogueCompact& livres, std::string_view isbn);
+
+#endif // INDEX_ISBN_HPP
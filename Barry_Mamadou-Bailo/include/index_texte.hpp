@@ -0,0 +1,63 @@
+/**
+ * @file index_texte.hpp
+ * @brief Index inversé pour la recherche plein texte (titre, auteurs, genre, description).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Au lieu de relire chaque livre à chaque recherche, on associe à chaque mot normalisé
+ * (minuscules, sans accents) la liste des livres qui le contiennent.
+ * Une recherche ne regarde donc que les listes des mots demandés.
+ *
+ * Syntaxe des requêtes :
+ *   - "victor hugo"      : livres contenant les deux mots (ET) ;
+ *   - "hugo OU zola"     : livres contenant l'un ou l'autre (OU / OR / |) ;
+ *   - "baudel*"          : mots commençant par "baudel" (préfixe).
+ * Les résultats sont classés par pertinence (mot dans le titre > auteurs > genre > description).
+ */
+
+#ifndef INDEX_TEXTE_HPP
+#define INDEX_TEXTE_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "catalogue_compact.hpp"
+
+// Présence d'un mot dans un livre, avec un poids selon le champ où il apparaît
+struct Occurrence {
+    std::uint32_t livre;   // Position du livre dans Library::books
+    std::uint32_t poids;   // Somme des poids des champs contenant le mot
+};
+
+// Poids de chaque champ dans le score de pertinence
+const std::uint32_t POIDS_TITRE = 8;
+const std::uint32_t POIDS_AUTEURS = 4;
+const std::uint32_t POIDS_GENRE = 2;
+const std::uint32_t POIDS_DESCRIPTION = 1;
+
+struct IndexTexte {
+    // Mot normalisé -> livres qui le contiennent (par position croissante).
+    // Une std::map garde les mots triés : les recherches par préfixe sont de simples parcours d'intervalle.
+    std::map<std::string, std::vector<Occurrence>> termes;
+
+    // L'index n'est construit qu'à la première recherche plein texte (pour ne pas ralentir
+    // le démarrage), puis il est tenu à jour à chaque ajout de livre.
+    bool construit = false;
+    std::uint32_t nbLivres = 0;
+};
+
+// Ajoute les mots d'un livre à l'index. Les livres doivent être ajoutés dans l'ordre de leur position.
+void indexerTexte(IndexTexte& index, std::uint32_t position, const LivreVue& livre);
+
+// Vide l'index (il sera reconstruit à la prochaine recherche).
+void viderIndexTexte(IndexTexte& index);
+
+// Construit l'index complet à partir d'une liste de livres (si ce n'est pas déjà fait).
+void construireIndexTexte(IndexTexte& index, const CatalogueCompact& livres);
+
+// Exécute une requête (voir la syntaxe plus haut) et retourne les positions des livres
+// trouvés, du plus pertinent au moins pertinent.
+std::vector<std::uint32_t> rechercherTexte(const IndexTexte& index, const std::string& requete);
+
+#endif // INDEX_TEXTE_HPP
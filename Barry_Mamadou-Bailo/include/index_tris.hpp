@@ -0,0 +1,90 @@
+/**
+ * @file index_tris.hpp
+ * @brief Index des ordres de tri du catalogue (titre, auteur, date, ISBN) pour l'affichage.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Les livres sont rangés dans l'ordre où ils ont été ajoutés. Pour les afficher par titre,
+ * il fallait jusqu'ici trier tout le catalogue (c'est ce que fait encore l'export HTML).
+ * Pour chaque ordre, l'index garde donc :
+ *  - 'ordre' : les positions des livres, triées (la page N d'une liste triée se lit
+ *    directement, à partir de l'entrée N x livresParPage, sans rien retrier) ;
+ *  - 'rangs' : pour chaque livre, sa place dans 'ordre'. Trier une liste de résultats
+ *    revient alors à trier des entiers (leurs rangs), sans comparer un seul texte.
+ *
+ * Comme l'index des dates, un ordre n'est construit que la première fois qu'il est demandé.
+ * Ensuite, les livres ajoutés attendent dans une petite liste, triée puis fusionnée avec
+ * l'ordre déjà trié à la question suivante (un seul tri pour tout un import).
+ *
+ * Pour la construction, chaque livre reçoit une clé courte de 8 octets (les 8 premiers
+ * caractères de sa clé de tri, en majuscules) : la plupart des comparaisons se font entre
+ * deux entiers, le texte n'est relu que si les 8 premiers caractères sont les mêmes.
+ */
+
+#ifndef INDEX_TRIS_HPP
+#define INDEX_TRIS_HPP
+
+#include <cctype>  // Pour std::toupper
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "catalogue_compact.hpp"
+
+// Les ordres proposés. À clé égale, l'ordre du catalogue est conservé.
+enum OrdreTri {
+    TRI_TITRE,    // Titre sans article ("Le", "La", "L'"...), sans tenir compte des majuscules
+    TRI_AUTEUR,   // Auteurs, sans tenir compte des majuscules
+    TRI_DATE,     // Date de parution, les livres sans date valide à la fin
+    TRI_ISBN,     // ISBN sans tirets ni espaces
+    NB_ORDRES_TRI
+};
+
+// Table des majuscules (même résultat que std::toupper, sans appel de fonction par caractère)
+inline unsigned char majuscule(char c) {
+    static const struct Table {
+        unsigned char v[256];
+        Table() { for (int i = 0; i < 256; i++) v[i] = static_cast<unsigned char>(std::toupper(i)); }
+    } table;
+    return table.v[static_cast<unsigned char>(c)];
+}
+
+// Longueur de l'article en début de titre à ignorer pour le tri (0 si aucun).
+std::uint32_t longueurArticle(std::string_view titre);
+
+// Compare a[debutA..] et b[debutB..] sans tenir compte des majuscules, octet par octet en
+// non signé (négatif si a passe avant b, 0 si égaux). Rien n'est copié.
+int comparerTitres(std::string_view a, std::size_t debutA, std::string_view b, std::size_t debutB);
+
+// Compare deux ISBN comme leurs formes normalisées (normaliserIsbn), sans les construire.
+int comparerIsbn(std::string_view a, std::string_view b);
+
+// Toutes les positions du catalogue, triées selon 'ordre' (à clé égale, par position).
+std::vector<std::uint32_t> ordreDuCatalogue(OrdreTri ordre, const CatalogueCompact& livres);
+
+// Un ordre de tri du catalogue
+struct IndexTri {
+    std::vector<std::uint32_t> ordre;      // Positions des livres, dans l'ordre de tri
+    std::vector<std::uint32_t> rangs;      // rangs[position] = place du livre dans 'ordre'
+    std::vector<std::uint32_t> enAttente;  // Ajoutés depuis la dernière question (pas encore triés)
+    bool construit = false;
+};
+
+struct IndexTris {
+    IndexTri parOrdre[NB_ORDRES_TRI];
+};
+
+// Ajoute un livre aux ordres déjà construits (les autres le prendront à leur construction).
+void indexerTris(IndexTris& index, std::uint32_t position);
+
+// Vide tous les ordres (ils seront reconstruits à la prochaine question).
+void viderIndexTris(IndexTris& index);
+
+// Construit l'ordre si nécessaire, y range les livres en attente et le retourne.
+const IndexTri& preparerIndexTri(IndexTris& index, OrdreTri ordre, const CatalogueCompact& livres);
+
+// Range 'positions' (des livres tous différents) dans l'ordre de 'index', qui doit être prêt.
+// Une grande liste est relue dans l'ordre de l'index (temps linéaire, sans tri) ; une petite
+// est triée par rang.
+void trierSelonIndex(const IndexTri& index, std::vector<std::uint32_t>& positions);
+
+#endif // INDEX_TRIS_HPP
@@ -0,0 +1,62 @@
+/**
+ * @file journal.hpp
+ * @brief Journal des modifications (ajout seulement) et compactage en arrière-plan.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Réécrire tout library.db pour un seul livre ajouté coûte des centaines de Mo sur un
+ * gros catalogue. À la place, chaque sauvegarde AJOUTE à la fin de 'library.db.journal'
+ * les opérations faites depuis la sauvegarde précédente :
+ *
+ *   A;isbn;titre;langue;auteurs;date;genre;description;.   ajout d'un livre
+ *   R;isbn;.                                               suppression d'un livre
+ *   C;.                                                    suppression de tous les livres
+ *   M;nom;description;.                                    nouveau nom / description
+ *
+ * Les champs suivent les règles CSV de csv.hpp (guillemets si besoin). Le '.' final
+ * prouve que la ligne a été écrite en entier : une ligne coupée par un arrêt brutal
+ * est ignorée. Au démarrage, chargerBibliotheque() lit library.db puis rejoue le journal.
+ *
+ * Quand le journal devient trop gros, il est renommé en 'library.db.journal.compactage'
+ * et un thread en arrière-plan produit un nouveau library.db qui l'intègre, pendant
+ * que les sauvegardes suivantes repartent dans un journal neuf.
+ *
+ * Rejouer une opération déjà présente dans library.db ne change pas le catalogue
+ * (un ajout d'ISBN existant est ignoré, une suppression d'ISBN absent aussi) :
+ * un arrêt au milieu du compactage ne fait donc rien perdre ni dupliquer.
+ */
+
+#ifndef JOURNAL_HPP
+#define JOURNAL_HPP
+
+#include <cstdint>
+#include <string>
+#include "library.hpp"
+
+const std::string EXTENSION_JOURNAL = ".journal";
+const std::string EXTENSION_COMPACTAGE = ".journal.compactage";
+
+// Le journal est compacté quand il dépasse SEUIL_COMPACTAGE ET le quart du fichier principal
+// (sinon, un gros catalogue serait réécrit en entier pour quelques Mo de modifications).
+const std::uintmax_t SEUIL_COMPACTAGE = 16 << 20; // 16 Mo
+
+// Ajoute au journal de 'fichierDb' les modifications en attente dans 'lib'.
+// Retourne false en cas d'erreur d'écriture (l'état en attente est alors conservé).
+bool ecrireJournal(Library& lib, const std::string& fichierDb);
+
+// Rejoue un fichier journal sur 'lib'. Retourne le nombre d'opérations appliquées (0 si absent).
+long rejouerJournal(Library& lib, const std::string& cheminJournal);
+
+// Considère l'état actuel de 'lib' comme écrit sur le disque (après chargement ou sauvegarde).
+void marquerCommeEcrit(Library& lib);
+
+// Supprime les journaux de 'fichierDb' (après une réécriture complète du fichier).
+void supprimerJournaux(const std::string& fichierDb);
+
+// Lance le compactage en arrière-plan si le journal a dépassé le seuil (et qu'aucun n'est en cours).
+void lancerCompactageSiNecessaire(const std::string& fichierDb);
+
+// Attend la fin d'un éventuel compactage (appelé automatiquement à la sortie du programme).
+void attendreCompactage();
+
+#endif // JOURNAL_HPP
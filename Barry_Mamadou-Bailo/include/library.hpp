@@ -12,49 +12,201 @@
 #define LIBRARY_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include "book.hpp" // Nécessaire car la structure Library utilise la structure Book
+#include "catalogue_compact.hpp" // Rangement des livres en mémoire
+#include "index_isbn.hpp" // ISBN -> position (doublons, recherche exacte)
+#include "index_texte.hpp" // Index de la recherche plein texte
+#include "index_approche.hpp" // Trigrammes des titres et auteurs (recherche approchée)
+#include "colonnes.hpp" // Colonnes langue / genre / date pour les filtres
+#include "index_dates.hpp" // Index trié des dates de parution
+#include "index_editeurs.hpp" // Index trié des éditeurs (structure de l'ISBN)
+#include "facettes.hpp" // Ensembles de livres par genre, langue et décennie (parcours)
+#include "index_tris.hpp" // Ordres de tri du catalogue (titre, auteur, date, ISBN) pour l'affichage
+#include "curseur.hpp" // Recherches parcourues au fur et à mesure de l'affichage
+
+// Ce qui a déjà été écrit sur le disque (fichier principal + journal, voir journal.hpp).
+// À chaque sauvegarde, on n'ajoute au journal que la différence avec cet état.
+struct EtatJournal {
+    std::size_t livresEcrits = 0;               // Les livres [0, livresEcrits) sont déjà sur le disque
+    bool viderEnAttente = false;                // supprimerToutesReferences() depuis la dernière sauvegarde
+    std::vector<std::string> suppressions;      // ISBN des livres écrits puis supprimés depuis
+    std::string nomEcrit, descriptionEcrite;    // Nom et description tels qu'ils sont sur le disque
+};
 
 // Structure principale représentant la bibliothèque
 struct Library {
     std::string name;               // Le nom de la bibliothèque (ex: "Ma Biblio Perso")
     std::string description;        // Une description affichée dans le menu
     
-    // J'utilise std::vector car c'est un tableau dynamique qui gère la mémoire automatiquement.
-    // Cela permet d'ajouter autant de livres que l'on veut sans connaître la taille à l'avance.
-    std::vector<Book> books;        
+    // Les livres, rangés de façon compacte (voir catalogue_compact.hpp).
+    // En lecture, il s'utilise comme un tableau : books.size(), books[i].title...
+    CatalogueCompact books;
+
+    // Index des ISBN : ISBN normalisé -> position du livre dans 'books'.
+    // Sans lui, chaque vérification de doublon parcourait tout le vecteur (très lent à l'import).
+    // Il doit rester synchronisé avec 'books' : on passe donc toujours par ajouterLivre().
+    IndexIsbn indexIsbn;
+
+    // Index inversé des mots (titre, auteurs, genre, description) pour la recherche plein texte
+    IndexTexte indexTexte;
+
+    // Vocabulaire des titres et auteurs et ses trigrammes, pour la recherche approchée
+    IndexApproche indexApproche;
+
+    // Langue, genre et date de chaque livre rangés en colonnes d'entiers, pour les filtres
+    ColonnesLivres colonnes;
+
+    // Dates de parution triées (tri par date, livres publiés entre deux dates)
+    IndexDates indexDates;
+
+    // Éditeurs tirés de l'ISBN (préfixe, groupe, éditeur), triés (recherche par code éditeur)
+    IndexEditeurs indexEditeurs;
+
+    // Livres de chaque genre, langue et décennie en bitmaps compressés (parcours par facettes)
+    IndexFacettes indexFacettes;
+
+    // Positions des livres triées par titre, auteur, date ou ISBN (listes triées du menu)
+    IndexTris indexTris;
+
+    // Format du fichier d'où vient la bibliothèque (texte ';' ou binaire, voir catalogue_bin.hpp).
+    // La sauvegarde réécrit dans le même format pour ne pas surprendre l'utilisateur.
+    bool formatBinaire = false;
+
+    // Modifications pas encore sauvegardées (pour l'écriture incrémentale)
+    EtatJournal journal;
+};
+
+// Bilan d'un import (pour afficher le débit à l'utilisateur)
+struct RapportImport {
+    long lignes = 0;         // Enregistrements lus dans le fichier (hors en-tête)
+    int threads = 1;         // Nombre de threads d'analyse utilisés
+    double secondes = 0;     // Durée totale de l'import
 };
 
 // --- FONCTIONS DE GESTION DES FICHIERS ---
 
-// Charge les données depuis le fichier DB au démarrage.
-// Retourne 'true' si le fichier a été trouvé et chargé, 'false' sinon.
-bool chargerBibliotheque(Library& lib, const std::string& filename);
+// Résultat d'un chargement. Un fichier présent mais abîmé (écriture interrompue, disque
+// plein, octets modifiés) ne doit surtout pas être pris pour un fichier absent : sinon
+// le programme repartirait d'une bibliothèque vide et écraserait ce qui reste.
+enum ResultatChargement {
+    CHARGE_OK,
+    CHARGE_ABSENT,      // Le fichier n'existe pas (premier lancement)
+    CHARGE_CORROMPU     // Fichier tronqué ou somme de contrôle fausse : rien n'est chargé
+};
+
+// Charge les données depuis le fichier DB au démarrage, puis rejoue son journal.
+// Le format (texte ou binaire) est détecté automatiquement.
+ResultatChargement chargerBibliotheque(Library& lib, const std::string& filename);
+
+// Charge uniquement le fichier DB (l'"instantané"), sans rejouer le journal.
+// Le format texte commence par la ligne "#BIBLIO;2" et se termine par "#SOMME;<16 chiffres
+// hexadécimaux>" : la somme de contrôle de tout ce qui précède (voir fichier_atomique.hpp).
+// Les anciens fichiers sans cette première ligne sont lus sans vérification.
+ResultatChargement chargerInstantane(Library& lib, const std::string& filename);
 
-// Sauvegarde les données actuelles dans le fichier DB.
-// Le paramètre 'lib' est 'const' pour garantir qu'on ne modifie pas les données pendant la sauvegarde.
-void sauvegarderBibliotheque(const Library& lib, const std::string& filename);
+// Sauvegarde les modifications depuis le dernier chargement ou la dernière sauvegarde.
+// Si le fichier DB existe, seules les modifications sont ajoutées au journal (library.db.journal) :
+// le temps de sauvegarde dépend de ce qui a changé, pas de la taille du catalogue.
+// Sinon, le fichier DB est écrit en entier.
+// Retourne false si l'écriture a échoué (le message d'erreur est déjà affiché).
+bool sauvegarderBibliotheque(Library& lib, const std::string& filename);
+
+// Réécrit entièrement le fichier DB (au format de 'lib') sans toucher aux journaux.
+// L'écriture passe par un fichier temporaire renommé à la fin : en cas d'arrêt ou
+// d'erreur, l'ancien fichier reste intact. Retourne false en cas d'erreur d'écriture.
+bool ecrireInstantane(const Library& lib, const std::string& filename);
+
+// Réécrit entièrement le fichier DB et supprime ses journaux (devenus inutiles).
+bool sauvegarderInstantane(const Library& lib, const std::string& filename);
 
 // Initialise une nouvelle bibliothèque avec des valeurs par défaut si aucun fichier n'existe.
 void initialiserBibliotheque(Library& lib);
 
 // --- FONCTIONS DE MANIPULATION DES LIVRES ---
 
+// (normaliserIsbn, qui met un ISBN sous forme canonique, est dans index_isbn.hpp)
+
 // Vérifie si un ISBN existe déjà dans la liste pour éviter les doublons.
-// Retourne true si trouvé.
-bool isbnExiste(const Library& lib, const std::string& isbn);
+// Retourne true si trouvé. Recherche rapide grâce à l'index (construit au premier appel).
+bool isbnExiste(Library& lib, std::string_view isbn);
+
+// Retourne la position du livre ayant cet ISBN dans 'books', ou -1 s'il n'existe pas.
+long trouverIsbn(Library& lib, std::string_view isbn);
+
+// Recherche plein texte (voir index_texte.hpp pour la syntaxe). Retourne les positions
+// des livres trouvés, les plus pertinents d'abord. L'index est construit au premier appel.
+std::vector<std::uint32_t> rechercherPleinTexte(Library& lib, const std::string& requete);
+
+// Recherche approchée dans les titres et auteurs : fautes de frappe et accents tolérés
+// (voir index_approche.hpp). L'index des trigrammes est construit au premier appel.
+std::vector<std::uint32_t> rechercherApprochee(Library& lib, const std::string& requete);
+
+// Recherche par titre (contient le texte, sans tenir compte des majuscules).
+// Rien n'est parcouru ici : le curseur avance à la demande (voir curseur.hpp).
+// La bibliothèque ne doit pas être modifiée tant que le curseur est utilisé.
+CurseurRecherche rechercherTitre(const Library& lib, const std::string& texte);
+
+// Recherche par code éditeur ("07", "2-07" ou "978-2-07", voir index_editeurs.hpp), que
+// l'ISBN soit écrit avec ou sans tirets. Les livres sont trouvés d'un coup dans l'index des
+// éditeurs (construit au premier appel) : le curseur rendu est déjà au bout.
+CurseurRecherche rechercherCodeEditeur(Library& lib, const std::string& code);
+
+// Positions des livres qui respectent le filtre (langue, genre, années), par ordre croissant.
+// Les colonnes sont construites au premier appel, puis tenues à jour comme l'index plein texte.
+std::vector<std::uint32_t> filtrerLivres(Library& lib, const FiltreLivres& filtre);
 
-// Ajoute un livre à la fin du vecteur 'books'.
+// Livres publiés entre 'dateMin' et 'dateMax' (AAAAMMJJ, incluses, voir dateCompacte),
+// du plus ancien au plus récent. Avec dateMin = 0 et dateMax = 0xFFFFFFFF : tous les livres
+// datés, triés par date. Deux recherches dichotomiques dans l'index des dates (construit
+// au premier appel) : pas de parcours du catalogue.
+TrancheDates livresEntreDates(Library& lib, std::uint32_t dateMin, std::uint32_t dateMax);
+
+// Index des facettes (genre, langue, décennie), construit au premier appel puis tenu à jour
+// à chaque ajout. Compter ou lister les livres d'une sélection ne parcourt pas le catalogue.
+const IndexFacettes& facettesDuCatalogue(Library& lib);
+
+// Tous les livres dans l'ordre 'ordre' (voir index_tris.hpp). L'ordre est trié au premier
+// appel, puis tenu à jour à chaque ajout : la page N se lit directement, sans retrier.
+// La référence reste valide jusqu'au prochain ajout ou à la prochaine suppression.
+const std::vector<std::uint32_t>& livresDansOrdre(Library& lib, OrdreTri ordre);
+
+// Range une liste de résultats (livres tous différents) dans l'ordre 'ordre', à l'aide du
+// même index : aucun texte n'est comparé.
+void trierSelon(Library& lib, OrdreTri ordre, std::vector<std::uint32_t>& positions);
+
+// Reconstruit entièrement l'index à partir de 'books'.
+// À appeler uniquement si le catalogue a été modifié directement (sans ajouterLivre).
+void reconstruireIndex(Library& lib);
+
+// Ajoute un livre à la fin de 'books' (et le référence dans l'index).
+// Le texte du livre est copié dans le catalogue : 'nouveauLivre' peut être réutilisé ensuite.
 void ajouterLivre(Library& lib, const Book& nouveauLivre);
 
+// Même chose à partir d'une vue (ex: champs d'une ligne CSV), sans créer de Book.
+void ajouterLivre(Library& lib, const LivreVue& nouveauLivre);
+
+// Supprime le livre ayant cet ISBN. Retourne false s'il n'existe pas.
+// Les positions des livres suivants changent : les index sont reconstruits (coût linéaire).
+bool supprimerLivre(Library& lib, const std::string& isbn);
+
+// Supprime d'un coup les livres ayant ces ISBN (ceux qui n'existent pas sont ignorés) : un
+// seul passage sur le catalogue et une seule reconstruction des index, quel que soit leur
+// nombre. Retourne le nombre de livres supprimés.
+std::size_t supprimerLivres(Library& lib, const std::vector<std::string>& isbns);
+
 // Vide le vecteur de livres (suppression totale).
 void supprimerToutesReferences(Library& lib);
 
 // Importe des livres depuis un fichier CSV externe.
-// Retourne le nombre entier de livres ajoutés avec succès.
-int importerReferences(Library& lib, const std::string& filename);
+// 'nbThreads' : nombre de threads d'analyse (0 = automatique, 1 = séquentiel, voir import.hpp).
+// Si 'rapport' est fourni, il est rempli avec le nombre de lignes lues et la durée.
+// Retourne le nombre entier de livres ajoutés avec succès (-1 si le fichier ne s'ouvre pas).
+int importerReferences(Library& lib, const std::string& filename, int nbThreads = 0, RapportImport* rapport = nullptr);
 
-// Génère une page Web (HTML) listant tous les livres, triés par titre.
-void exporterHTML(const Library& lib, const std::string& filename);
+// Génère une page Web (HTML) listant tous les livres, triés par titre (voir export_html.cpp).
+// Retourne false si le fichier n'a pas pu être créé ou entièrement écrit (disque plein...).
+bool exporterHTML(const Library& lib, const std::string& filename);
 
 #endif // LIBRARY_HPP
\ No newline at end of file
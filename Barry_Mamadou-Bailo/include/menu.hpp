@@ -21,21 +21,33 @@ void afficherMenuPrincipal(const AppConfig& config);
 
 // Fonction générique pour afficher n'importe quelle liste de livres page par page.
 // Elle est utilisée aussi bien pour "Consulter" (tous les livres) que pour "Rechercher" (résultats filtrés).
-// - lib : sert à afficher le nom de la bibliothèque en haut.
-// - livresAAfficher : le vecteur contenant les livres à montrer.
+// - lib : sert à afficher le nom de la bibliothèque en haut (et au parcours par facettes,
+//   proposé depuis la consultation : son index est construit à la première ouverture).
+// - livresAAfficher : les livres à montrer. Aucun livre n'est copié : une liste de résultats
+//   n'est qu'une liste de positions dans lib.books (4 octets par livre trouvé), seuls les
+//   livres de la page affichée sont relus dans le catalogue.
 // - titreMenu : le titre à afficher en haut (ex: "RÉSULTATS DE RECHERCHE").
-void afficherListePaginee(const Library& lib, const std::vector<Book>& livresAAfficher, std::string titreMenu, const AppConfig& config);
+// Dans la liste, [O] trie par titre, auteur, date ou ISBN (index persistant, voir index_tris.hpp)
+// et [A] va directement à une page : ni l'un ni l'autre ne retrie à chaque changement de page.
+void afficherListePaginee(Library& lib, const std::vector<std::uint32_t>& positions, std::string titreMenu, const AppConfig& config);
+void afficherListePaginee(Library& lib, const TrancheDates& livresParDate, std::string titreMenu, const AppConfig& config);
+// Avec un curseur (voir curseur.hpp), seuls les livres des pages demandées sont cherchés :
+// la première page s'affiche sans attendre la fin du parcours du catalogue.
+void afficherListePaginee(Library& lib, CurseurRecherche& curseur, std::string titreMenu, const AppConfig& config);
+void afficherListePaginee(Library& lib, const CatalogueCompact& livresAAfficher, std::string titreMenu, const AppConfig& config);
 
 // Affiche la fiche détaillée d'un livre spécifique (toutes les infos).
-void afficherDetailsLivre(const Book& livre, const AppConfig& config);
+void afficherDetailsLivre(const LivreVue& livre, const AppConfig& config);
 
 // --- FONCTIONS DE NAVIGATION (Sous-menus) ---
 
 // Gère l'option 1 : Affiche tous les livres de la bibliothèque.
-void consulterReferences(const Library& lib, const AppConfig& config);
+// [F] dans la liste ouvre le parcours par genre, langue et décennie (voir facettes.hpp).
+void consulterReferences(Library& lib, const AppConfig& config);
 
-// Gère l'option 3 : Menu de recherche (par titre, ISBN...).
-void chercherReferences(const Library& lib, const AppConfig& config);
+// Gère l'option 3 : Menu de recherche (par titre, ISBN, plein texte...).
+// 'lib' n'est pas const : l'index plein texte est construit lors de la première recherche.
+void chercherReferences(Library& lib, const AppConfig& config);
 
 // Gère l'option 2 : Menu d'ajout, d'importation et de suppression.
 // Le booléen 'aDesModifs' est passé par référence (&) modifiable.
@@ -0,0 +1,112 @@
+/**
+ * @file mesures.hpp
+ * @brief Statistiques de performance : durée, volume et allocations des opérations coûteuses.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Le chargement, la sauvegarde, l'import, l'export HTML et les recherches du menu sont
+ * entourés d'une MesureEnCours : un objet créé au début de l'opération et détruit à la fin
+ * (portée C++), qui ajoute alors aux statistiques de l'opération :
+ *  - le nombre d'appels et leur durée (totale, maximale, et un histogramme des durées) ;
+ *  - le nombre de lignes ou de livres traités et d'octets lus ou écrits ;
+ *  - le nombre d'allocations mémoire faites pendant l'opération (tous threads confondus).
+ *
+ * Les mesures sont désactivées par défaut (Paramètres > Statistiques de performance).
+ * Désactivées, elles ne coûtent qu'un test de booléen au début et à la fin de chaque
+ * opération, et un par allocation : pas d'horloge lue, pas de fichier consulté.
+ *
+ * Les statistiques ne sont mises à jour que par le thread principal (les opérations
+ * mesurées peuvent utiliser des threads, mais commencent et finissent dans le principal).
+ */
+
+#ifndef MESURES_HPP
+#define MESURES_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Fichier du rapport écrit en quittant, si demandé dans les paramètres
+const std::string FICHIER_MESURES = "mesures.txt";
+
+// Les opérations mesurées
+enum OperationMesuree {
+    MESURE_CHARGEMENT,  // chargerBibliotheque (octets : fichier DB)
+    MESURE_SAUVEGARDE,  // sauvegarderBibliotheque (octets : ajoutés au journal ou fichier DB réécrit)
+    MESURE_IMPORT,      // importerReferences (lignes lues, octets du fichier CSV)
+    MESURE_EXPORT_HTML, // exporterHTML (livres écrits, octets de la page)
+    MESURE_RECHERCHE,   // recherches du menu (lignes : résultats trouvés)
+    NB_OPERATIONS_MESUREES
+};
+
+// Histogramme des durées : la tranche k compte les appels de moins de 2^k microsecondes
+// (et d'au moins 2^(k-1)) ; la tranche 0 ceux de moins d'une microseconde.
+const int NB_TRANCHES_DUREE = 32;
+
+struct StatsOperation {
+    std::uint64_t appels = 0;
+    std::uint64_t lignes = 0;
+    std::uint64_t octets = 0;
+    std::uint64_t allocations = 0;
+    std::uint64_t nanosecondes = 0;    // Durée totale
+    std::uint64_t maxNanosecondes = 0; // Appel le plus long
+    std::uint64_t tranches[NB_TRANCHES_DUREE] = {};
+};
+
+// Vrai quand les mesures sont activées (lu à chaque opération mesurée et à chaque allocation)
+extern std::atomic<bool> mesuresActives;
+
+// Nombre d'allocations (operator new) depuis le démarrage, compté seulement quand les mesures sont actives
+extern std::atomic<std::uint64_t> allocationsComptees;
+
+// Mesure d'une opération, du constructeur jusqu'au destructeur (fin de la portée)
+struct MesureEnCours {
+    OperationMesuree operation;
+    bool active;                                  // Les mesures étaient-elles activées au début ?
+    std::chrono::steady_clock::time_point debut;
+    std::uint64_t allocationsDebut = 0;
+    std::uint64_t lignes = 0;
+    std::uint64_t octets = 0;
+
+    explicit MesureEnCours(OperationMesuree op)
+        : operation(op), active(mesuresActives.load(std::memory_order_relaxed)) {
+        if (active) {
+            allocationsDebut = allocationsComptees.load(std::memory_order_relaxed);
+            debut = std::chrono::steady_clock::now();
+        }
+    }
+    ~MesureEnCours();
+
+    // Une mesure n'est ajoutée qu'une fois aux statistiques : pas de copie
+    MesureEnCours(const MesureEnCours&) = delete;
+    MesureEnCours& operator=(const MesureEnCours&) = delete;
+};
+
+// Ajoutent des lignes (ou livres) traitées et des octets lus ou écrits à la mesure en cours
+inline void compterLignes(MesureEnCours& mesure, std::uint64_t nombre) { if (mesure.active) mesure.lignes += nombre; }
+inline void compterOctets(MesureEnCours& mesure, std::uint64_t nombre) { if (mesure.active) mesure.octets += nombre; }
+
+// Taille d'un fichier en octets (0 s'il n'existe pas). À n'appeler que si la mesure est active.
+std::uint64_t tailleFichierMesure(const std::string& chemin);
+
+// Active ou désactive les mesures (les statistiques déjà relevées sont conservées)
+void activerMesures(bool actives);
+
+// Statistiques relevées pour une opération depuis le démarrage (ou la remise à zéro)
+const StatsOperation& statsOperation(OperationMesuree operation);
+
+// Nom court d'une opération (ex: "chargement")
+const char* nomOperation(OperationMesuree operation);
+
+// Efface toutes les statistiques relevées
+void remettreMesuresAZero();
+
+// Écrit un rapport lisible des statistiques (tableau, puis histogramme des durées par opération)
+void ecrireRapportMesures(std::ostream& sortie);
+
+// Demande l'écriture du rapport dans 'fichier' à la fin du programme (chaîne vide : ne plus l'écrire)
+void ecrireMesuresEnQuittant(const std::string& fichier);
+
+#endif // MESURES_HPP
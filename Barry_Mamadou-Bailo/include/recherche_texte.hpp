@@ -0,0 +1,58 @@
+/**
+ * @file recherche_texte.hpp
+ * @brief Recherche d'un texte dans un autre (titre, ISBN), sans allocation, 16 ou 32 octets à la fois.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * La recherche par titre (options 2 et 3 de "Rechercher") parcourt tout le catalogue.
+ * Avant, chaque titre était recopié en minuscules (toLower : une allocation par livre),
+ * puis parcouru octet par octet par std::string::find.
+ *
+ * Ici, le motif est préparé une seule fois (mis en minuscules), puis chaque titre est lu
+ * sur place, par blocs de 16 octets (SSE2) ou 32 octets (AVX2) :
+ *  - dans chaque bloc, on cherche en une instruction les positions où le titre a la même
+ *    première lettre que le motif ET la même dernière lettre (k - 1 octets plus loin) ;
+ *  - les majuscules A-Z sont passées en minuscules dans le registre, pendant la comparaison ;
+ *  - seules ces positions candidates (rares) sont vérifiées lettre par lettre.
+ *
+ * Comme l'ancien toLower, seules les lettres ASCII sont concernées par la casse : les
+ * lettres accentuées (plusieurs octets en UTF-8) doivent être tapées telles quelles.
+ *
+ * AVX2 n'existe pas sur tous les processeurs x86-64 : la version est choisie à l'exécution
+ * (une fois par motif). Sans SSE2 (autre processeur), une version simple octet par octet sert.
+ */
+
+#ifndef RECHERCHE_TEXTE_HPP
+#define RECHERCHE_TEXTE_HPP
+
+#include <string>
+#include <string_view>
+
+// Versions de la recherche (NOYAU_AUTO : la plus rapide disponible sur ce processeur)
+enum NoyauRecherche { NOYAU_AUTO, NOYAU_SCALAIRE, NOYAU_SSE2, NOYAU_AVX2 };
+
+// Motif préparé une fois par recherche, puis comparé à chaque livre
+struct MotifRecherche {
+    std::string motif;  // Texte cherché (en minuscules si la casse est ignorée)
+    bool (*contient)(std::string_view texte, std::string_view motif) = nullptr; // Version choisie
+};
+
+// Prépare 'motif' ; ignorerCasse = true pour ne pas distinguer majuscules et minuscules (A-Z).
+// Une version non disponible sur ce processeur est remplacée par la version simple.
+MotifRecherche preparerMotif(std::string_view motif, bool ignorerCasse, NoyauRecherche noyau = NOYAU_AUTO);
+
+// Vrai si 'texte' contient le motif (toujours vrai pour un motif vide, comme std::string::find)
+inline bool contientMotif(std::string_view texte, const MotifRecherche& motif) {
+    return motif.contient(texte, motif.motif);
+}
+
+// Vrai si cette version peut tourner sur ce processeur
+bool noyauDisponible(NoyauRecherche noyau);
+
+// La version utilisée par NOYAU_AUTO
+NoyauRecherche noyauAutomatique();
+
+// Nom court d'une version (ex: "avx2")
+const char* nomNoyau(NoyauRecherche noyau);
+
+#endif // RECHERCHE_TEXTE_HPP
@@ -0,0 +1,44 @@
+/**
+ * @file tampon_sortie.hpp
+ * @brief Écriture de fichier par gros blocs, avec échappement HTML à la volée.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Écrire ligne par ligne avec 'fichier << ... << std::endl' vide le tampon du flux à
+ * chaque std::endl : sur un gros catalogue, cela fait des dizaines de millions d'appels
+ * système. Ici on accumule le texte dans un tampon de TAILLE_TAMPON_SORTIE octets et on
+ * l'envoie au fichier en un seul 'write' quand il est plein.
+ */
+
+#ifndef TAMPON_SORTIE_HPP
+#define TAMPON_SORTIE_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+const std::size_t TAILLE_TAMPON_SORTIE = 1 << 20; // 1 Mo
+
+struct SommeControle; // Voir fichier_atomique.hpp
+
+struct TamponSortie {
+    std::ostream* sortie = nullptr;
+    std::string tampon;        // Texte en attente (capacité réservée une fois pour toutes)
+    SommeControle* somme = nullptr; // Si non nul : reçoit tout ce qui part vers le flux
+};
+
+// Associe le tampon à un flux déjà ouvert (fichier, std::cout...).
+void ouvrirTamponSortie(TamponSortie& t, std::ostream& sortie);
+
+// Envoie le contenu du tampon au flux (à appeler à la fin, sinon la fin du texte est perdue).
+void viderTamponSortie(TamponSortie& t);
+
+// Ajoute un texte tel quel (balises HTML, texte déjà sûr...).
+void ecrire(TamponSortie& t, std::string_view texte);
+
+// Ajoute un texte venant des données (titre, auteurs...) en échappant les caractères
+// spéciaux du HTML : & < > " ' (un titre "Tom & Jerry" ne doit pas casser la page).
+void ecrireEchappeHTML(TamponSortie& t, std::string_view texte);
+
+#endif // TAMPON_SORTIE_HPP
@@ -14,7 +14,9 @@
 #ifndef UTILS_HPP
 #define UTILS_HPP
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include "config.hpp" // Nécessaire pour afficher le logo stocké dans la config
 
 // --- PALETTE DE COULEURS (ANSI Escape Codes) ---
@@ -54,11 +56,25 @@ void afficherHeader(const std::string& titre, const AppConfig& config);
 
 // Convertit une chaîne en minuscules.
 // Indispensable pour la recherche insensible à la casse (ex: "Paris" == "paris").
-std::string toLower(const std::string& str);
+std::string toLower(std::string_view str);
+
+// Normalise un texte pour la recherche : minuscules, accents retirés (é -> e, œ -> oe...)
+// et ponctuation remplacée par des espaces. Ex: "L'Étranger" -> "l etranger".
+std::string normaliserTexte(std::string_view texte);
 
 // Vérifie si une date respecte strictement le format JJ/MM/AAAA.
 // Vérifie aussi la cohérence (pas de 32 janvier ou 30 février).
-bool estDateValide(const std::string& date);
+bool estDateValide(std::string_view date);
+
+// Date JJ/MM/AAAA rangée dans un entier AAAAMMJJ (ex: "14/07/1789" -> 17890714).
+// L'ordre des entiers est celui des dates : on peut comparer ou trier sans rien découper.
+// Retourne 0 si la date est invalide (mêmes règles que estDateValide).
+std::uint32_t dateCompacte(std::string_view date);
+
+// Borne d'un intervalle de dates saisie par l'utilisateur : JJ/MM/AAAA, ou une année seule
+// (le 1er janvier pour une borne de début, le 31 décembre pour une borne de fin).
+// Retourne la date AAAAMMJJ, ou 0 si la saisie n'est ni l'un ni l'autre.
+std::uint32_t borneDate(std::string_view saisie, bool fin);
 
 // Fonction utilitaire pour répéter un caractère N fois.
 // Utile pour créer des lignes de séparation (ex: "----------").
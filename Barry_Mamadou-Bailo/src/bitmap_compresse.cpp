@@ -0,0 +1,195 @@
+/**
+ * @file bitmap_compresse.cpp
+ * @brief Ensembles de positions compressés : ajout, ET, comptage (voir bitmap_compresse.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::binary_search, std::set_intersection
+#include <iterator>  // Pour std::back_inserter
+#include "bitmap_compresse.hpp"
+
+// Un bit du tableau : mot bas / 64, bit bas % 64
+static std::uint64_t bitDe(std::uint16_t bas) {
+    return std::uint64_t{1} << (bas & 63);
+}
+
+// Passe un bloc de la liste au tableau de bits (quand la liste deviendrait plus grosse)
+static void enTableauDeBits(BlocBits& bloc) {
+    bloc.bits.assign(MOTS_PAR_BLOC, 0);
+    for (std::uint16_t bas : bloc.liste) bloc.bits[bas >> 6] |= bitDe(bas);
+    std::vector<std::uint16_t>().swap(bloc.liste); // Rend la mémoire de la liste
+}
+
+// Passe un bloc du tableau de bits à la liste (s'il contient peu de livres)
+static void enListe(BlocBits& bloc) {
+    bloc.liste.reserve(bloc.nombre);
+    for (std::size_t i = 0; i < MOTS_PAR_BLOC; i++) {
+        for (std::uint64_t mot = bloc.bits[i]; mot != 0; mot &= mot - 1) {
+            bloc.liste.push_back(static_cast<std::uint16_t>(i * 64 + static_cast<std::size_t>(__builtin_ctzll(mot))));
+        }
+    }
+    std::vector<std::uint64_t>().swap(bloc.bits);
+}
+
+// Le bloc contient-il la position 'bas' ?
+static bool contient(const BlocBits& bloc, std::uint16_t bas) {
+    if (!bloc.bits.empty()) return (bloc.bits[bas >> 6] & bitDe(bas)) != 0;
+    return std::binary_search(bloc.liste.begin(), bloc.liste.end(), bas);
+}
+
+void ajouterPosition(BitmapCompresse& ensemble, std::uint32_t position) {
+    const std::uint32_t haut = position >> 16;
+    const std::uint16_t bas = static_cast<std::uint16_t>(position & 0xFFFF);
+    if (ensemble.blocs.empty() || ensemble.blocs.back().haut != haut) {
+        ensemble.blocs.emplace_back();
+        ensemble.blocs.back().haut = haut;
+    }
+    BlocBits& bloc = ensemble.blocs.back();
+    if (bloc.bits.empty()) {
+        bloc.liste.push_back(bas);
+        if (bloc.liste.size() > MAX_LISTE) enTableauDeBits(bloc);
+    } else {
+        bloc.bits[bas >> 6] |= bitDe(bas);
+    }
+    bloc.nombre++;
+    ensemble.nombre++;
+}
+
+// Nombre de livres communs à deux blocs de même 'haut'
+static std::uint32_t compterBloc(const BlocBits& a, const BlocBits& b) {
+    std::uint32_t communs = 0;
+    if (!a.bits.empty() && !b.bits.empty()) {
+        // 64 livres à la fois
+        for (std::size_t i = 0; i < MOTS_PAR_BLOC; i++) {
+            communs += static_cast<std::uint32_t>(__builtin_popcountll(a.bits[i] & b.bits[i]));
+        }
+    } else if (a.bits.empty() && b.bits.empty()) {
+        // Deux listes triées : on avance dans les deux à la fois
+        std::size_t i = 0, j = 0;
+        while (i < a.liste.size() && j < b.liste.size()) {
+            if (a.liste[i] < b.liste[j]) i++;
+            else if (a.liste[i] > b.liste[j]) j++;
+            else { communs++; i++; j++; }
+        }
+    } else {
+        // Une liste : chacune de ses positions est cherchée dans l'autre bloc
+        const BlocBits& liste = a.bits.empty() ? a : b;
+        const BlocBits& autre = a.bits.empty() ? b : a;
+        for (std::uint16_t bas : liste.liste) communs += contient(autre, bas) ? 1 : 0;
+    }
+    return communs;
+}
+
+// Livres communs à deux blocs de même 'haut'
+static BlocBits croiserBloc(const BlocBits& a, const BlocBits& b) {
+    BlocBits resultat;
+    resultat.haut = a.haut;
+    if (!a.bits.empty() && !b.bits.empty()) {
+        resultat.bits.resize(MOTS_PAR_BLOC);
+        for (std::size_t i = 0; i < MOTS_PAR_BLOC; i++) {
+            resultat.bits[i] = a.bits[i] & b.bits[i];
+            resultat.nombre += static_cast<std::uint32_t>(__builtin_popcountll(resultat.bits[i]));
+        }
+        if (resultat.nombre <= MAX_LISTE) enListe(resultat);
+        return resultat;
+    }
+    if (a.bits.empty() && b.bits.empty()) {
+        std::set_intersection(a.liste.begin(), a.liste.end(), b.liste.begin(), b.liste.end(),
+                              std::back_inserter(resultat.liste));
+    } else {
+        const BlocBits& liste = a.bits.empty() ? a : b;
+        const BlocBits& autre = a.bits.empty() ? b : a;
+        for (std::uint16_t bas : liste.liste) {
+            if (contient(autre, bas)) resultat.liste.push_back(bas);
+        }
+    }
+    resultat.nombre = static_cast<std::uint32_t>(resultat.liste.size());
+    return resultat;
+}
+
+std::uint32_t compterCommuns(const BitmapCompresse& a, const BitmapCompresse& b) {
+    std::uint32_t communs = 0;
+    std::size_t i = 0, j = 0;
+    // Seuls les blocs présents des deux côtés peuvent avoir des livres communs
+    while (i < a.blocs.size() && j < b.blocs.size()) {
+        if (a.blocs[i].haut < b.blocs[j].haut) i++;
+        else if (a.blocs[i].haut > b.blocs[j].haut) j++;
+        else communs += compterBloc(a.blocs[i++], b.blocs[j++]);
+    }
+    return communs;
+}
+
+std::vector<std::uint32_t> compterCommunsPlusieurs(const BitmapCompresse& base, const std::vector<const BitmapCompresse*>& autres) {
+    std::vector<std::uint32_t> communs(autres.size(), 0);
+    std::vector<std::size_t> suivants(autres.size(), 0); // Prochain bloc à regarder dans chaque autre ensemble
+    std::vector<std::uint64_t> bitsBase(MOTS_PAR_BLOC, 0); // Bloc courant de 'base' en tableau de bits (8 Ko, réutilisé)
+
+    for (const BlocBits& bloc : base.blocs) {
+        const std::vector<std::uint64_t>& bits = bloc.bits.empty() ? bitsBase : bloc.bits;
+        for (std::uint16_t bas : bloc.liste) bitsBase[bas >> 6] |= bitDe(bas);
+
+        for (std::size_t k = 0; k < autres.size(); k++) {
+            const std::vector<BlocBits>& blocs = autres[k]->blocs;
+            std::size_t& j = suivants[k];
+            while (j < blocs.size() && blocs[j].haut < bloc.haut) j++;
+            if (j == blocs.size() || blocs[j].haut != bloc.haut) continue;
+
+            const BlocBits& autre = blocs[j];
+            if (!autre.bits.empty()) {
+                // Tableau de bits de l'autre côté : la liste de 'base' y est testée, ou ET et popcount
+                communs[k] += compterBloc(bloc, autre);
+                continue;
+            }
+            // Liste de l'autre ensemble : un test de bit par position, sans branchement
+            std::uint32_t n = 0;
+            for (std::uint16_t bas : autre.liste) n += static_cast<std::uint32_t>((bits[bas >> 6] >> (bas & 63)) & 1);
+            communs[k] += n;
+        }
+
+        for (std::uint16_t bas : bloc.liste) bitsBase[bas >> 6] = 0; // Remis à zéro pour le bloc suivant
+    }
+    return communs;
+}
+
+BitmapCompresse intersection(const BitmapCompresse& a, const BitmapCompresse& b) {
+    BitmapCompresse resultat;
+    std::size_t i = 0, j = 0;
+    while (i < a.blocs.size() && j < b.blocs.size()) {
+        if (a.blocs[i].haut < b.blocs[j].haut) i++;
+        else if (a.blocs[i].haut > b.blocs[j].haut) j++;
+        else {
+            BlocBits bloc = croiserBloc(a.blocs[i++], b.blocs[j++]);
+            if (bloc.nombre == 0) continue; // Pas de bloc vide
+            resultat.nombre += bloc.nombre;
+            resultat.blocs.push_back(std::move(bloc));
+        }
+    }
+    return resultat;
+}
+
+std::vector<std::uint32_t> positionsBitmap(const BitmapCompresse& ensemble) {
+    std::vector<std::uint32_t> positions;
+    positions.reserve(ensemble.nombre);
+    for (const BlocBits& bloc : ensemble.blocs) {
+        const std::uint32_t base = bloc.haut << 16;
+        if (bloc.bits.empty()) {
+            for (std::uint16_t bas : bloc.liste) positions.push_back(base + bas);
+            continue;
+        }
+        for (std::size_t i = 0; i < MOTS_PAR_BLOC; i++) {
+            for (std::uint64_t mot = bloc.bits[i]; mot != 0; mot &= mot - 1) {
+                positions.push_back(base + static_cast<std::uint32_t>(i * 64) + static_cast<std::uint32_t>(__builtin_ctzll(mot)));
+            }
+        }
+    }
+    return positions;
+}
+
+std::size_t octetsBitmap(const BitmapCompresse& ensemble) {
+    std::size_t octets = sizeof(BitmapCompresse) + ensemble.blocs.capacity() * sizeof(BlocBits);
+    for (const BlocBits& bloc : ensemble.blocs) {
+        octets += bloc.liste.capacity() * sizeof(std::uint16_t) + bloc.bits.capacity() * sizeof(std::uint64_t);
+    }
+    return octets;
+}
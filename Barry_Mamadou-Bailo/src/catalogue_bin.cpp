@@ -0,0 +1,327 @@
+/**
+ * @file catalogue_bin.cpp
+ * @brief Lecture (mmap) et écriture du format binaire du catalogue.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Voir catalogue_bin.hpp pour la description du format.
+ */
+
+#include <cstring>   // Pour std::memcmp / std::memcpy
+#include <fstream>
+#include <iostream>
+#include "catalogue_bin.hpp"
+#include "fichier_atomique.hpp" // Écriture sûre et somme de contrôle
+
+#ifndef _WIN32
+    #include <fcntl.h>     // open()
+    #include <sys/mman.h>  // mmap() / munmap()
+    #include <sys/stat.h>  // fstat() pour connaître la taille du fichier
+    #include <unistd.h>    // close()
+#endif
+
+// Les tailles doivent être identiques sur toutes les machines, sinon le fichier serait illisible
+static_assert(sizeof(EnTeteCatalogue) == 48, "En-tête du catalogue : taille inattendue");
+static_assert(sizeof(EntreeLivre) == 40, "Entrée de la table : taille inattendue");
+static_assert(sizeof(LivreCompact) == 40, "Livre du catalogue compact : taille inattendue");
+static_assert(sizeof(EnTeteDictionnaires) == 8 && sizeof(EntreeValeur) == 16, "Dictionnaires : taille inattendue");
+
+bool estCatalogueBinaire(const std::string& filename) {
+    std::ifstream fichier(filename, std::ios::binary);
+    char debut[sizeof(MAGIQUE_CATALOGUE)];
+    if (!fichier.read(debut, sizeof(debut))) return false;
+    return std::memcmp(debut, MAGIQUE_CATALOGUE, sizeof(debut)) == 0;
+}
+
+void fermerCatalogueBinaire(CatalogueMappe& cat) {
+#ifndef _WIN32
+    if (cat.donnees != nullptr && cat.copie.empty()) {
+        munmap(const_cast<char*>(cat.donnees), cat.taille);
+    }
+#endif
+    cat.copie.clear();
+    cat.donnees = nullptr;
+    cat.taille = 0;
+    cat.entete = nullptr;
+    cat.tas = nullptr;
+    cat.table = nullptr;
+    cat.livres = nullptr;
+    cat.ordreIsbn = nullptr;
+    cat.dictionnaires = nullptr;
+    cat.valeurs = nullptr;
+}
+
+// Versions 1 et 2 : la table de 7 longueurs par livre, puis le tas.
+static bool verifierAncienCatalogue(CatalogueMappe& cat, std::uint64_t tailleStructure) {
+    std::uint64_t tailleTable = std::uint64_t(cat.entete->nbLivres) * sizeof(EntreeLivre);
+    if (tailleTable != tailleStructure) return false;
+
+    // Version 2 : tout ce qui suit l'en-tête doit correspondre à la somme enregistrée.
+    // (Cela lit tout le fichier, mais chargerCatalogueBinaire le copie de toute façon.)
+    if (cat.entete->version == 2) {
+        SommeControle somme;
+        initialiserSomme(somme);
+        ajouterSomme(somme, cat.donnees + sizeof(EnTeteCatalogue), cat.taille - sizeof(EnTeteCatalogue));
+        if (valeurSomme(somme) != cat.entete->sommeControle) return false;
+    }
+
+    cat.table = reinterpret_cast<const EntreeLivre*>(cat.donnees + sizeof(EnTeteCatalogue));
+
+    // Chaque livre doit tenir entièrement dans le tas
+    for (std::uint32_t i = 0; i < cat.entete->nbLivres; i++) {
+        std::uint64_t fin = cat.table[i].debut;
+        for (int c = 0; c < NB_CHAMPS; c++) fin += cat.table[i].tailles[c];
+        if (fin > cat.entete->tailleTas) return false;
+    }
+    return true;
+}
+
+// Version 3 : table, ordre des ISBN et dictionnaires. Seule cette partie est sommée ici
+// (quelques dizaines d'octets par livre) : le tas, bien plus gros, n'est pas relu à
+// l'ouverture. Les positions et les numéros sont quand même tous vérifiés, pour qu'un
+// tas abîmé ne puisse au pire donner que du texte faux, jamais une lecture hors du fichier.
+static bool verifierCatalogueV3(CatalogueMappe& cat, std::uint64_t tailleStructure) {
+    const std::uint64_t n = cat.entete->nbLivres;
+    const std::uint64_t tailleTable = n * sizeof(LivreCompact);
+    const std::uint64_t tailleOrdre = (n * sizeof(std::uint32_t) + 7) / 8 * 8; // Aligné sur 8 octets
+    if (tailleStructure < tailleTable + tailleOrdre + sizeof(EnTeteDictionnaires)) return false;
+
+    const char* p = cat.donnees + sizeof(EnTeteCatalogue);
+    cat.livres = reinterpret_cast<const LivreCompact*>(p);
+    cat.ordreIsbn = reinterpret_cast<const std::uint32_t*>(p + tailleTable);
+    cat.dictionnaires = reinterpret_cast<const EnTeteDictionnaires*>(p + tailleTable + tailleOrdre);
+    cat.valeurs = reinterpret_cast<const EntreeValeur*>(cat.dictionnaires + 1);
+    const std::uint64_t nbValeurs = std::uint64_t(cat.dictionnaires->nbLangues) + cat.dictionnaires->nbGenres;
+    if (tailleStructure != tailleTable + tailleOrdre + sizeof(EnTeteDictionnaires) + nbValeurs * sizeof(EntreeValeur)) {
+        return false;
+    }
+
+    SommeControle somme;
+    initialiserSomme(somme);
+    ajouterSomme(somme, p, tailleStructure);
+    if (valeurSomme(somme) != cat.entete->sommeControle) return false;
+
+    const std::uint64_t tailleTas = cat.entete->tailleTas;
+    for (std::uint64_t v = 0; v < nbValeurs; v++) {
+        if (cat.valeurs[v].debut > tailleTas || cat.valeurs[v].taille > tailleTas - cat.valeurs[v].debut) return false;
+    }
+    for (std::uint64_t i = 0; i < n; i++) {
+        const LivreCompact& l = cat.livres[i];
+        std::uint64_t fin = l.debut;
+        for (int t = 0; t < NB_TEXTES; t++) fin += l.tailles[t];
+        if (l.debut > tailleTas || fin > tailleTas) return false;
+        if (l.langue >= cat.dictionnaires->nbLangues || l.genre >= cat.dictionnaires->nbGenres) return false;
+        if (cat.ordreIsbn[i] >= n) return false;
+    }
+    return true;
+}
+
+// Vérifie que l'en-tête et la table sont cohérents avec la taille réelle du fichier.
+// Sans ça, un fichier tronqué ferait lire en dehors de la mémoire projetée.
+static bool verifierCatalogue(CatalogueMappe& cat) {
+    if (cat.taille < sizeof(EnTeteCatalogue)) return false;
+
+    cat.entete = reinterpret_cast<const EnTeteCatalogue*>(cat.donnees);
+    if (std::memcmp(cat.entete->magique, MAGIQUE_CATALOGUE, sizeof(MAGIQUE_CATALOGUE)) != 0) return false;
+    if (cat.entete->version < 1 || cat.entete->version > VERSION_CATALOGUE) return false;
+
+    // Le tas est à la fin du fichier ; la table (et le reste) entre l'en-tête et le tas
+    if (cat.entete->tailleTas > cat.taille - sizeof(EnTeteCatalogue)) return false;
+    if (std::uint64_t(cat.entete->tailleNom) + cat.entete->tailleDescription > cat.entete->tailleTas) return false;
+    std::uint64_t tailleStructure = cat.taille - sizeof(EnTeteCatalogue) - cat.entete->tailleTas;
+    cat.tas = cat.donnees + sizeof(EnTeteCatalogue) + tailleStructure;
+
+    if (cat.entete->version < 3) return verifierAncienCatalogue(cat, tailleStructure);
+    return verifierCatalogueV3(cat, tailleStructure);
+}
+
+bool ouvrirCatalogueBinaire(CatalogueMappe& cat, const std::string& filename) {
+    fermerCatalogueBinaire(cat);
+
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat infos;
+    if (fstat(fd, &infos) != 0 || infos.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    cat.taille = static_cast<std::size_t>(infos.st_size);
+
+    // Le système charge les pages à la demande : l'ouverture est quasi instantanée
+    void* zone = mmap(nullptr, cat.taille, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // La projection reste valide après la fermeture du descripteur
+    if (zone == MAP_FAILED) {
+        cat.taille = 0;
+        return false;
+    }
+    cat.donnees = static_cast<const char*>(zone);
+#else
+    // Pas de mmap sous Windows : on lit le fichier d'un seul bloc
+    std::ifstream fichier(filename, std::ios::binary | std::ios::ate);
+    if (!fichier) return false;
+    cat.copie.resize(static_cast<std::size_t>(fichier.tellg()));
+    fichier.seekg(0);
+    if (!fichier.read(cat.copie.data(), cat.copie.size())) return false;
+    cat.donnees = cat.copie.data();
+    cat.taille = cat.copie.size();
+#endif
+
+    if (!verifierCatalogue(cat)) {
+        fermerCatalogueBinaire(cat);
+        return false;
+    }
+    return true;
+}
+
+// Versions 1 et 2 : les champs ne sont pas rangés comme dans le catalogue compact, chaque
+// livre y est donc copié (les vues pointent sur le tas projeté, un seul passage).
+static void copierAncienCatalogue(Library& lib, const CatalogueMappe& cat) {
+    reserverCatalogue(lib.books, cat.entete->nbLivres);
+    for (std::uint32_t i = 0; i < cat.entete->nbLivres; i++) {
+        const EntreeLivre& e = cat.table[i];
+        const char* p = cat.tas + e.debut;
+        LivreVue b;
+        std::string_view* champs[NB_CHAMPS] = {
+            &b.isbn, &b.title, &b.language, &b.authors, &b.date, &b.genre, &b.description
+        };
+        for (int c = 0; c < NB_CHAMPS; c++) {
+            *champs[c] = std::string_view(p, e.tailles[c]);
+            p += e.tailles[c];
+        }
+        ajouterLivre(lib, b);
+    }
+}
+
+// Rend les valeurs d'un dictionnaire du fichier (quelques dizaines : seul travail du chargement)
+static void lireDictionnaire(Dictionnaire& dico, const CatalogueMappe& cat, const EntreeValeur* valeurs, std::uint32_t nombre) {
+    for (std::uint32_t i = 0; i < nombre; i++) {
+        std::string_view valeur(cat.tas + valeurs[i].debut, valeurs[i].taille);
+        dico.valeurs.push_back(valeur);
+        dico.numeros.emplace(valeur, i);
+    }
+}
+
+bool chargerCatalogueBinaire(Library& lib, const std::string& filename) {
+    // Le fichier projeté est partagé avec le catalogue, qui le libère quand il est vidé
+    std::shared_ptr<CatalogueMappe> cat(new CatalogueMappe, [](CatalogueMappe* c) {
+        fermerCatalogueBinaire(*c);
+        delete c;
+    });
+    if (!ouvrirCatalogueBinaire(*cat, filename)) return false;
+
+    lib.name.assign(cat->tas, cat->entete->tailleNom);
+    lib.description.assign(cat->tas + cat->entete->tailleNom, cat->entete->tailleDescription);
+    supprimerToutesReferences(lib);
+    lib.formatBinaire = true;
+
+    if (cat->entete->version < 3) {
+        copierAncienCatalogue(lib, *cat);
+        return true; // 'cat' est libéré ici : tout a été copié
+    }
+
+    // Version 3 : aucun livre n'est copié ni indexé. Le catalogue lit la table et le tas du
+    // fichier, et l'index des ISBN cherche dans l'ordre rangé par la sauvegarde.
+    const EnTeteDictionnaires& dicos = *cat->dictionnaires;
+    lireDictionnaire(lib.books.langues, *cat, cat->valeurs, dicos.nbLangues);
+    lireDictionnaire(lib.books.genres, *cat, cat->valeurs + dicos.nbLangues, dicos.nbGenres);
+    lib.books.livres.donnees = cat->livres;
+    lib.books.livres.nombre = cat->entete->nbLivres;
+    lib.books.base = cat->tas;
+    lib.books.fichier = cat;
+    utiliserOrdreFichier(lib.indexIsbn, cat->ordreIsbn, cat->entete->nbLivres);
+    return true;
+}
+
+bool verifierTas(const CatalogueCompact& livres) {
+    if (!livres.fichier || livres.fichier->entete->version < 3) return true;
+    const CatalogueMappe& cat = *livres.fichier;
+    SommeControle somme;
+    initialiserSomme(somme);
+    ajouterSomme(somme, cat.tas, cat.entete->tailleTas);
+    return valeurSomme(somme) == cat.entete->sommeTas;
+}
+
+bool sauvegarderCatalogueBinaire(const Library& lib, const std::string& filename) {
+    FichierAtomique fichier;
+    if (!ouvrirFichierAtomique(fichier, filename)) {
+        std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename << std::endl;
+        return false;
+    }
+    const CatalogueCompact& livres = lib.books;
+    const Dictionnaire* dicos[2] = {&livres.langues, &livres.genres};
+
+    // 1. Dictionnaires et table (on calcule les positions avant d'écrire le tas) : le tas
+    // commence par le nom, la description et les valeurs des dictionnaires
+    std::uint64_t position = lib.name.size() + lib.description.size();
+    std::vector<EntreeValeur> valeurs;
+    for (const Dictionnaire* dico : dicos) {
+        for (std::string_view valeur : dico->valeurs) {
+            valeurs.push_back({position, static_cast<std::uint32_t>(valeur.size()), 0});
+            position += valeur.size();
+        }
+    }
+    // Les livres gardent leurs numéros de langue et de genre ; seul 'debut' change
+    std::vector<LivreCompact> table(livres.livres.begin(), livres.livres.end());
+    for (LivreCompact& l : table) {
+        l.debut = position;
+        for (int t = 0; t < NB_TEXTES; t++) position += l.tailles[t];
+    }
+    std::vector<std::uint32_t> ordreIsbn = ordreDuCatalogue(TRI_ISBN, livres);
+    if (ordreIsbn.size() % 2 != 0) ordreIsbn.push_back(0); // Alignement sur 8 octets
+
+    // 2. En-tête
+    EnTeteCatalogue entete = {};
+    std::memcpy(entete.magique, MAGIQUE_CATALOGUE, sizeof(MAGIQUE_CATALOGUE));
+    entete.version = VERSION_CATALOGUE;
+    entete.nbLivres = static_cast<std::uint32_t>(livres.size());
+    entete.tailleTas = position;
+    entete.tailleNom = static_cast<std::uint32_t>(lib.name.size());
+    entete.tailleDescription = static_cast<std::uint32_t>(lib.description.size());
+    EnTeteDictionnaires enteteDicos = {static_cast<std::uint32_t>(livres.langues.valeurs.size()),
+                                       static_cast<std::uint32_t>(livres.genres.valeurs.size())};
+
+    // L'en-tête est écrit directement dans le flux (hors somme), puis réécrit à la fin
+    // avec les deux sommes, une fois qu'elles sont connues.
+    fichier.flux.write(reinterpret_cast<const char*>(&entete), sizeof(entete));
+    TamponSortie& t = fichier.tampon;
+
+    // 3. Table, ordre des ISBN et dictionnaires : leur somme est à part (vérifiée à l'ouverture)
+    SommeControle sommeStructure;
+    initialiserSomme(sommeStructure);
+    t.somme = &sommeStructure;
+    ecrire(t, std::string_view(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(LivreCompact)));
+    ecrire(t, std::string_view(reinterpret_cast<const char*>(ordreIsbn.data()), ordreIsbn.size() * sizeof(std::uint32_t)));
+    ecrire(t, std::string_view(reinterpret_cast<const char*>(&enteteDicos), sizeof(enteteDicos)));
+    ecrire(t, std::string_view(reinterpret_cast<const char*>(valeurs.data()), valeurs.size() * sizeof(EntreeValeur)));
+    viderTamponSortie(t);
+    t.somme = &fichier.somme;
+
+    // 4. Tas de chaînes : nom, description, valeurs, puis les 5 textes de chaque livre,
+    // déjà bout à bout dans le catalogue (une seule écriture par livre)
+    ecrire(t, lib.name);
+    ecrire(t, lib.description);
+    for (const Dictionnaire* dico : dicos) {
+        for (std::string_view valeur : dico->valeurs) ecrire(t, valeur);
+    }
+    for (std::size_t i = 0; i < livres.size(); i++) {
+        const LivreCompact& l = livres.livres[i];
+        std::size_t total = 0;
+        for (int c = 0; c < NB_TEXTES; c++) total += l.tailles[c];
+        ecrire(t, std::string_view(livres.texte(l), total));
+    }
+
+    // 5. Sommes de contrôle dans l'en-tête
+    viderTamponSortie(t);
+    entete.sommeControle = valeurSomme(sommeStructure);
+    entete.sommeTas = valeurSomme(fichier.somme);
+    fichier.flux.seekp(0);
+    fichier.flux.write(reinterpret_cast<const char*>(&entete), sizeof(entete));
+
+    if (!validerFichierAtomique(fichier)) {
+        std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename << std::endl;
+        return false;
+    }
+    return true;
+}
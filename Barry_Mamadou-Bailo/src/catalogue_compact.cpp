@@ -0,0 +1,145 @@
+/**
+ * @file catalogue_compact.cpp
+ * @brief Arène de texte, dictionnaires et catalogue compact (voir catalogue_compact.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <cstring> // Pour std::memcpy
+#include "catalogue_compact.hpp"
+#include "utils.hpp" // Pour dateCompacte et toLower
+
+LivreVue vueLivre(const Book& livre) {
+    return {livre.isbn, livre.title, livre.language, livre.authors, livre.date, livre.genre, livre.description};
+}
+
+Book copierLivre(const LivreVue& vue) {
+    Book b;
+    b.isbn.assign(vue.isbn);
+    b.title.assign(vue.title);
+    b.language.assign(vue.language);
+    b.authors.assign(vue.authors);
+    b.date.assign(vue.date);
+    b.genre.assign(vue.genre);
+    b.description.assign(vue.description);
+    return b;
+}
+
+char* reserverTexte(ArenaTexte& arene, std::size_t taille) {
+    if (taille > arene.resteBloc) {
+        // Bloc courant plein : on en commence un nouveau (l'ancien n'est pas déplacé,
+        // les vues sur son contenu restent donc valides)
+        std::size_t tailleBloc = taille > TAILLE_BLOC_ARENE ? taille : TAILLE_BLOC_ARENE;
+        arene.blocs.emplace_back(new char[tailleBloc]);
+        arene.libre = arene.blocs.back().get();
+        arene.resteBloc = tailleBloc;
+    }
+    char* debut = arene.libre;
+    arene.libre += taille;
+    arene.resteBloc -= taille;
+    arene.octetsUtilises += taille;
+    return debut;
+}
+
+void viderArene(ArenaTexte& arene) {
+    arene.blocs.clear();
+    arene.blocs.shrink_to_fit();
+    arene.libre = nullptr;
+    arene.resteBloc = 0;
+    arene.octetsUtilises = 0;
+}
+
+std::uint32_t internerValeur(Dictionnaire& dico, ArenaTexte& arene, std::string_view valeur) {
+    auto trouve = dico.numeros.find(valeur);
+    if (trouve != dico.numeros.end()) return trouve->second;
+
+    // Nouvelle valeur : on la range dans l'arène pour que la clé de la table ne bouge plus
+    char* copie = reserverTexte(arene, valeur.size());
+    if (!valeur.empty()) std::memcpy(copie, valeur.data(), valeur.size());
+    std::string_view rangee(copie, valeur.size());
+
+    std::uint32_t numero = static_cast<std::uint32_t>(dico.valeurs.size());
+    dico.valeurs.push_back(rangee);
+    dico.numeros.emplace(rangee, numero);
+    return numero;
+}
+
+long chercherValeur(const Dictionnaire& dico, std::string_view valeur) {
+    // Un dictionnaire ne contient que quelques dizaines de valeurs : un simple parcours suffit
+    std::string cherche = toLower(valeur);
+    for (std::size_t i = 0; i < dico.valeurs.size(); i++) {
+        if (toLower(dico.valeurs[i]) == cherche) return static_cast<long>(i);
+    }
+    return -1;
+}
+
+// Le tableau des livres, modifiable : une table projetée est d'abord recopiée (une seule
+// fois, 40 octets par livre ; les textes, eux, restent dans le fichier).
+static std::vector<LivreCompact>& livresModifiables(TableLivres& table) {
+    if (table.donnees != table.propres.data()) {
+        table.propres.assign(table.donnees, table.donnees + table.nombre);
+    }
+    return table.propres;
+}
+
+// À appeler après chaque modification de 'propres' (le vector a pu être déplacé)
+static void synchroniserTable(TableLivres& table) {
+    table.donnees = table.propres.data();
+    table.nombre = table.propres.size();
+}
+
+void ajouterAuCatalogue(CatalogueCompact& cat, const LivreVue& livre) {
+    const std::string_view textes[NB_TEXTES] = {livre.isbn, livre.title, livre.authors, livre.date, livre.description};
+
+    LivreCompact l;
+    std::size_t total = 0;
+    for (int t = 0; t < NB_TEXTES; t++) {
+        l.tailles[t] = static_cast<std::uint32_t>(textes[t].size());
+        total += textes[t].size();
+    }
+
+    // Les 5 textes sont copiés bout à bout : une seule réservation par livre
+    char* p = reserverTexte(cat.arene, total);
+    l.debut = reinterpret_cast<std::uintptr_t>(p) - reinterpret_cast<std::uintptr_t>(cat.base);
+    for (const auto& texte : textes) {
+        if (!texte.empty()) std::memcpy(p, texte.data(), texte.size());
+        p += texte.size();
+    }
+
+    l.langue = internerValeur(cat.langues, cat.arene, livre.language);
+    l.genre = internerValeur(cat.genres, cat.arene, livre.genre);
+    l.date = dateCompacte(livre.date); // Décodée une seule fois, ici
+    livresModifiables(cat.livres).push_back(l);
+    synchroniserTable(cat.livres);
+}
+
+void retirerDuCatalogue(CatalogueCompact& cat, std::size_t position) {
+    std::vector<LivreCompact>& livres = livresModifiables(cat.livres);
+    livres.erase(livres.begin() + static_cast<std::ptrdiff_t>(position));
+    synchroniserTable(cat.livres);
+}
+
+void retirerDuCatalogue(CatalogueCompact& cat, const std::vector<bool>& aRetirer) {
+    std::vector<LivreCompact>& livres = livresModifiables(cat.livres);
+    std::size_t gardes = 0;
+    for (std::size_t i = 0; i < livres.size(); i++) {
+        if (!aRetirer[i]) livres[gardes++] = livres[i];
+    }
+    livres.resize(gardes);
+    synchroniserTable(cat.livres);
+}
+
+void viderCatalogue(CatalogueCompact& cat) {
+    cat.livres = TableLivres();
+    cat.langues = Dictionnaire();
+    cat.genres = Dictionnaire();
+    viderArene(cat.arene);
+    // Les vues sur le fichier sont toutes parties : on peut le libérer
+    cat.fichier.reset();
+    cat.base = nullptr;
+}
+
+void reserverCatalogue(CatalogueCompact& cat, std::size_t nombre) {
+    livresModifiables(cat.livres).reserve(nombre);
+    synchroniserTable(cat.livres);
+}
@@ -0,0 +1,136 @@
+/**
+ * @file colonnes.cpp
+ * @brief Colonnes langue / genre / date et filtres vectorisés (voir colonnes.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include "colonnes.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h> // Instructions SSE2 (registres de 128 bits)
+#endif
+
+// Numéro de dictionnaire tel qu'il est rangé dans une colonne 16 bits
+static std::uint16_t numeroColonne(std::uint32_t numero) {
+    return numero >= NUMERO_DEBORDE ? NUMERO_DEBORDE : static_cast<std::uint16_t>(numero);
+}
+
+void filtrerAnnees(FiltreLivres& filtre, int debut, int fin) {
+    if (debut < 1) debut = 1; // La date 0 est réservée aux dates invalides
+    filtre.dateMin = static_cast<std::uint32_t>(debut) * 10000;
+    filtre.dateMax = static_cast<std::uint32_t>(fin) * 10000 + 9999;
+}
+
+void ajouterAuxColonnes(ColonnesLivres& colonnes, const LivreCompact& livre) {
+    colonnes.langue.push_back(numeroColonne(livre.langue));
+    colonnes.genre.push_back(numeroColonne(livre.genre));
+    colonnes.date.push_back(livre.date);
+}
+
+void viderColonnes(ColonnesLivres& colonnes) {
+    colonnes = ColonnesLivres();
+}
+
+void construireColonnes(ColonnesLivres& colonnes, const CatalogueCompact& livres) {
+    if (colonnes.construit) return;
+    viderColonnes(colonnes);
+    colonnes.langue.reserve(livres.size());
+    colonnes.genre.reserve(livres.size());
+    colonnes.date.reserve(livres.size());
+    for (const LivreCompact& l : livres.livres) ajouterAuxColonnes(colonnes, l);
+    colonnes.construit = true;
+}
+
+// Le filtre, préparé une fois pour toutes avant le parcours
+struct FiltrePrepare {
+    bool parLangue, parGenre;
+    std::uint16_t langue, genre;
+    std::uint32_t dateMin, dateMax;
+};
+
+static FiltrePrepare preparer(const FiltreLivres& filtre) {
+    FiltrePrepare p;
+    p.parLangue = filtre.langue >= 0;
+    p.parGenre = filtre.genre >= 0;
+    p.langue = p.parLangue ? numeroColonne(static_cast<std::uint32_t>(filtre.langue)) : 0;
+    p.genre = p.parGenre ? numeroColonne(static_cast<std::uint32_t>(filtre.genre)) : 0;
+    p.dateMin = filtre.dateMin;
+    p.dateMax = filtre.dateMax;
+    return p;
+}
+
+// Le livre 'i' respecte-t-il le filtre ?
+static bool garde(const ColonnesLivres& c, const FiltrePrepare& p, std::size_t i) {
+    return (!p.parLangue || c.langue[i] == p.langue)
+        && (!p.parGenre || c.genre[i] == p.genre)
+        && c.date[i] >= p.dateMin && c.date[i] <= p.dateMax;
+}
+
+std::vector<std::uint32_t> filtrerColonnesScalaire(const ColonnesLivres& colonnes, const FiltreLivres& filtre) {
+    FiltrePrepare p = preparer(filtre);
+    std::vector<std::uint32_t> resultat;
+    for (std::size_t i = 0; i < colonnes.date.size(); i++) {
+        if (garde(colonnes, p, i)) resultat.push_back(static_cast<std::uint32_t>(i));
+    }
+    return resultat;
+}
+
+std::vector<std::uint32_t> filtrerColonnes(const ColonnesLivres& colonnes, const FiltreLivres& filtre) {
+    FiltrePrepare p = preparer(filtre);
+    std::vector<std::uint32_t> resultat;
+    const std::size_t nombre = colonnes.date.size();
+    std::size_t i = 0;
+
+#ifdef __SSE2__
+    // 8 livres par tour : 8 numéros de 16 bits tiennent dans un registre, les 8 dates dans deux.
+    const __m128i tous = _mm_set1_epi32(-1);
+    const __m128i langueCherchee = _mm_set1_epi16(static_cast<short>(p.langue));
+    const __m128i genreCherche = _mm_set1_epi16(static_cast<short>(p.genre));
+    const bool parDate = p.dateMin > 0 || p.dateMax < 0xFFFFFFFF;
+
+    // SSE2 ne sait comparer que des entiers signés : en inversant le bit de poids fort,
+    // l'ordre des entiers non signés devient celui des entiers signés.
+    const __m128i signe = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    const __m128i dateMin = _mm_set1_epi32(static_cast<int>(p.dateMin ^ 0x80000000u));
+    const __m128i dateMax = _mm_set1_epi32(static_cast<int>(p.dateMax ^ 0x80000000u));
+
+    const std::uint16_t* langues = colonnes.langue.data();
+    const std::uint16_t* genres = colonnes.genre.data();
+    const std::uint32_t* dates = colonnes.date.data();
+
+    for (; i + 8 <= nombre; i += 8) {
+        // Chaque voie de 16 bits vaut 0xFFFF si le livre est gardé, 0 sinon
+        __m128i masque = tous;
+        if (p.parLangue) {
+            __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(langues + i));
+            masque = _mm_and_si128(masque, _mm_cmpeq_epi16(l, langueCherchee));
+        }
+        if (p.parGenre) {
+            __m128i g = _mm_loadu_si128(reinterpret_cast<const __m128i*>(genres + i));
+            masque = _mm_and_si128(masque, _mm_cmpeq_epi16(g, genreCherche));
+        }
+        if (parDate) {
+            __m128i d0 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dates + i)), signe);
+            __m128i d1 = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(dates + i + 4)), signe);
+            __m128i hors0 = _mm_or_si128(_mm_cmpgt_epi32(dateMin, d0), _mm_cmpgt_epi32(d0, dateMax));
+            __m128i hors1 = _mm_or_si128(_mm_cmpgt_epi32(dateMin, d1), _mm_cmpgt_epi32(d1, dateMax));
+            // Deux fois 4 résultats sur 32 bits -> 8 résultats sur 16 bits
+            masque = _mm_andnot_si128(_mm_packs_epi32(hors0, hors1), masque);
+        }
+
+        // 8 voies de 16 bits -> 8 octets -> 8 bits (un par livre)
+        unsigned bits = static_cast<unsigned>(_mm_movemask_epi8(_mm_packs_epi16(masque, _mm_setzero_si128())));
+        while (bits != 0) {
+            resultat.push_back(static_cast<std::uint32_t>(i + static_cast<std::size_t>(__builtin_ctz(bits))));
+            bits &= bits - 1; // Efface le bit traité
+        }
+    }
+#endif
+
+    // Les derniers livres (moins de 8), ou tout le catalogue sans SSE2
+    for (; i < nombre; i++) {
+        if (garde(colonnes, p, i)) resultat.push_back(static_cast<std::uint32_t>(i));
+    }
+    return resultat;
+}
@@ -0,0 +1,364 @@
+/**
+ * @file commandes.cpp
+ * @brief Mode commande : import, export, recherche et statistiques sans menu (voir commandes.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <cstdio>     // Pour std::snprintf
+#include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "commandes.hpp"
+#include "csv.hpp"         // Pour ecrireChampCSV
+#include "export_html.hpp"
+#include "library.hpp"
+#include "utils.hpp"       // Pour borneDate
+
+// Codes de retour du programme
+const int SORTIE_OK = 0;
+const int SORTIE_ERREUR = 1;
+const int SORTIE_USAGE = 2;
+
+// Options sans valeur, et options suivies d'une valeur (--db fichier, --limit 10...)
+static const std::set<std::string> DRAPEAUX = {"--json", "--help"};
+static const std::set<std::string> OPTIONS = {"--db", "--threads", "--per-page", "--limit", "--isbn", "--title",
+                                              "--publisher", "--text", "--fuzzy", "--genre", "--language", "--from", "--to"};
+
+// Arguments découpés : la commande, les arguments simples et les options "--nom valeur"
+struct Arguments {
+    std::string commande;
+    std::vector<std::string> positionnels;
+    std::map<std::string, std::string> options;
+    std::set<std::string> drapeaux;
+    std::string erreur; // Non vide si les arguments sont mal écrits
+};
+
+static Arguments decouperArguments(int argc, char* argv[]) {
+    Arguments args;
+    if (argc > 1) args.commande = argv[1];
+    for (int i = 2; i < argc; i++) {
+        std::string mot = argv[i];
+        if (mot.rfind("--", 0) != 0) {
+            args.positionnels.push_back(mot);
+        } else if (DRAPEAUX.count(mot)) {
+            args.drapeaux.insert(mot);
+        } else if (!OPTIONS.count(mot)) {
+            args.erreur = "option inconnue " + mot;
+        } else if (i + 1 < argc) {
+            args.options[mot] = argv[++i];
+        } else {
+            args.erreur = "l'option " + mot + " attend une valeur";
+        }
+    }
+    return args;
+}
+
+static std::string option(const Arguments& args, const std::string& nom, const std::string& parDefaut = "") {
+    auto it = args.options.find(nom);
+    return it == args.options.end() ? parDefaut : it->second;
+}
+
+// Lit une option entière. Retourne false si elle est présente mais n'est pas un nombre.
+static bool optionEntiere(const Arguments& args, const std::string& nom, long& valeur) {
+    auto it = args.options.find(nom);
+    if (it == args.options.end()) return true;
+    try {
+        std::size_t lus = 0;
+        valeur = std::stol(it->second, &lus);
+        return lus == it->second.size();
+    } catch (...) {
+        return false;
+    }
+}
+
+static int erreurUsage(const std::string& message) {
+    std::cerr << "Erreur : " << message << " (voir ./app help)" << std::endl;
+    return SORTIE_USAGE;
+}
+
+static void afficherAide() {
+    std::cout << "Usage : ./app [commande] [options]   (sans commande : menu interactif)\n"
+                 "\n"
+                 "  import FICHIER.csv [--threads N]     Importe un CSV puis sauvegarde\n"
+                 "  export-html FICHIER.html             Exporte le catalogue en une page\n"
+                 "  export-html DOSSIER/ [--per-page N]  Exporte une page par lettre dans DOSSIER\n"
+                 "  search CRITERE [--json] [--limit N]  Cherche des livres (une ligne CSV par livre)\n"
+                 "      --isbn X | --title X | --publisher CODE | --text \"requete\" | --fuzzy \"mots\"\n"
+                 "      --genre G  --language L  --from DATE  --to DATE  (DATE = JJ/MM/AAAA ou AAAA)\n"
+                 "  stats [--json]                       Nombre de livres, genres, langues, dates\n"
+                 "  help                                 Affiche cette aide\n"
+                 "\n"
+                 "Option commune : --db FICHIER (library.db par défaut)\n";
+}
+
+// Charge la bibliothèque. Si 'creerSiAbsente', un fichier absent donne une bibliothèque vide.
+static bool chargerPourCommande(Library& lib, const std::string& fichierDb, bool creerSiAbsente) {
+    ResultatChargement resultat = chargerBibliotheque(lib, fichierDb);
+    if (resultat == CHARGE_CORROMPU) {
+        std::cerr << "Erreur : " << fichierDb << " est incomplet ou corrompu (somme de contrôle invalide)." << std::endl;
+        return false;
+    }
+    if (resultat == CHARGE_ABSENT) {
+        if (!creerSiAbsente) {
+            std::cerr << "Erreur : " << fichierDb << " introuvable." << std::endl;
+            return false;
+        }
+        initialiserBibliotheque(lib);
+    }
+    return true;
+}
+
+// --- SORTIE JSON ---
+
+// Écrit 'texte' entre guillemets, en échappant ce que JSON interdit dans une chaîne
+static void ecrireChaineJSON(std::ostream& sortie, std::string_view texte) {
+    sortie << '"';
+    for (char c : texte) {
+        switch (c) {
+            case '"':  sortie << "\\\""; break;
+            case '\\': sortie << "\\\\"; break;
+            case '\n': sortie << "\\n"; break;
+            case '\r': sortie << "\\r"; break;
+            case '\t': sortie << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+                    sortie << code;
+                } else {
+                    sortie << c;
+                }
+        }
+    }
+    sortie << '"';
+}
+
+static void ecrireLivreJSON(std::ostream& sortie, const LivreVue& livre) {
+    sortie << "{\"isbn\":";          ecrireChaineJSON(sortie, livre.isbn);
+    sortie << ",\"titre\":";         ecrireChaineJSON(sortie, livre.title);
+    sortie << ",\"langue\":";        ecrireChaineJSON(sortie, livre.language);
+    sortie << ",\"auteurs\":";       ecrireChaineJSON(sortie, livre.authors);
+    sortie << ",\"date\":";          ecrireChaineJSON(sortie, livre.date);
+    sortie << ",\"genre\":";         ecrireChaineJSON(sortie, livre.genre);
+    sortie << ",\"description\":";   ecrireChaineJSON(sortie, livre.description);
+    sortie << '}';
+}
+
+// Même format que les fichiers importés : le résultat d'une recherche peut être réimporté
+static void ecrireLivreCSV(std::ostream& sortie, const LivreVue& livre) {
+    ecrireChampCSV(sortie, livre.isbn); sortie << ';';
+    ecrireChampCSV(sortie, livre.title); sortie << ';';
+    ecrireChampCSV(sortie, livre.language); sortie << ';';
+    ecrireChampCSV(sortie, livre.authors); sortie << ';';
+    ecrireChampCSV(sortie, livre.date); sortie << ';';
+    ecrireChampCSV(sortie, livre.genre); sortie << ';';
+    ecrireChampCSV(sortie, livre.description); sortie << '\n';
+}
+
+// --- COMMANDES ---
+
+static int commandeImport(const Arguments& args, const std::string& fichierDb) {
+    if (args.positionnels.size() != 1) return erreurUsage("import attend un fichier CSV");
+    long nbThreads = 0;
+    if (!optionEntiere(args, "--threads", nbThreads) || nbThreads < 0) return erreurUsage("--threads attend un nombre");
+
+    Library lib;
+    if (!chargerPourCommande(lib, fichierDb, true)) return SORTIE_ERREUR;
+
+    RapportImport rapport;
+    int ajoutes = importerReferences(lib, args.positionnels[0], static_cast<int>(nbThreads), &rapport);
+    if (ajoutes < 0) {
+        std::cerr << "Erreur : impossible d'ouvrir " << args.positionnels[0] << std::endl;
+        return SORTIE_ERREUR;
+    }
+    if (!sauvegarderBibliotheque(lib, fichierDb)) return SORTIE_ERREUR; // L'erreur est déjà affichée
+
+    if (args.drapeaux.count("--json")) {
+        std::cout << "{\"ajoutes\":" << ajoutes << ",\"lignes\":" << rapport.lignes << ",\"threads\":" << rapport.threads
+                  << ",\"secondes\":" << rapport.secondes << ",\"livres\":" << lib.books.size() << "}\n";
+    } else {
+        std::cout << ajoutes << " livres ajoutés sur " << rapport.lignes << " lignes en " << rapport.secondes
+                  << " s (" << rapport.threads << " threads), " << lib.books.size() << " livres au total.\n";
+    }
+    return SORTIE_OK;
+}
+
+static int commandeExport(const Arguments& args, const std::string& fichierDb) {
+    if (args.positionnels.size() != 1) return erreurUsage("export-html attend un fichier .html ou un dossier");
+    long livresParPage = LIVRES_PAR_PAGE_HTML;
+    if (!optionEntiere(args, "--per-page", livresParPage) || livresParPage <= 0) return erreurUsage("--per-page attend un nombre positif");
+
+    Library lib;
+    if (!chargerPourCommande(lib, fichierDb, false)) return SORTIE_ERREUR;
+
+    const std::string& cible = args.positionnels[0];
+    bool unFichier = cible.size() > 5 && cible.compare(cible.size() - 5, 5, ".html") == 0;
+    if (unFichier) {
+        if (!exporterHTML(lib, cible)) return SORTIE_ERREUR; // L'erreur est déjà affichée
+        std::cout << cible << " : " << lib.books.size() << " livres.\n";
+    } else {
+        int nbFichiers = exporterHTMLParLettre(lib, cible, static_cast<int>(livresParPage));
+        if (nbFichiers < 0) return SORTIE_ERREUR;
+        std::cout << cible << " : " << lib.books.size() << " livres, " << nbFichiers << " fichiers.\n";
+    }
+    return SORTIE_OK;
+}
+
+static int commandeRecherche(const Arguments& args, const std::string& fichierDb) {
+    const bool json = args.drapeaux.count("--json") > 0;
+    long limite = std::numeric_limits<long>::max();
+    if (!optionEntiere(args, "--limit", limite) || limite < 0) return erreurUsage("--limit attend un nombre");
+    const std::size_t maximum = static_cast<std::size_t>(limite);
+
+    // Un seul critère "texte", ou un filtre (genre / langue / dates, combinables)
+    const std::vector<std::string> criteresTexte = {"--isbn", "--title", "--publisher", "--text", "--fuzzy"};
+    const std::vector<std::string> criteresFiltre = {"--genre", "--language", "--from", "--to"};
+    std::string critere;
+    for (const auto& nom : criteresTexte) {
+        if (!args.options.count(nom)) continue;
+        if (!critere.empty()) return erreurUsage("un seul critère parmi --isbn, --title, --publisher, --text, --fuzzy");
+        critere = nom;
+    }
+    bool parFiltre = false;
+    for (const auto& nom : criteresFiltre) parFiltre = parFiltre || args.options.count(nom);
+    if (critere.empty() && !parFiltre) return erreurUsage("search attend un critère");
+    if (!critere.empty() && parFiltre) return erreurUsage("--genre, --language, --from et --to ne se combinent pas avec " + critere);
+
+    Library lib;
+    if (!chargerPourCommande(lib, fichierDb, false)) return SORTIE_ERREUR;
+
+    // Les résultats : des positions dans lib.books, comme pour le menu
+    std::vector<std::uint32_t> positions;
+    TrancheDates parDate;
+    bool utiliseTranche = false;
+    CurseurRecherche curseur;
+
+    if (critere == "--isbn") {
+        long position = trouverIsbn(lib, option(args, critere));
+        if (position != -1) positions.push_back(static_cast<std::uint32_t>(position));
+    } else if (critere == "--title" || critere == "--publisher") {
+        // Avec --limit, le curseur s'arrête dès qu'il a trouvé assez de livres
+        curseur = (critere == "--title") ? rechercherTitre(lib, option(args, critere))
+                                         : rechercherCodeEditeur(lib, option(args, critere));
+        avancerCurseur(curseur, maximum);
+        positions.swap(curseur.trouves);
+    } else if (critere == "--text") {
+        positions = rechercherPleinTexte(lib, option(args, critere));
+    } else if (critere == "--fuzzy") {
+        positions = rechercherApprochee(lib, option(args, critere));
+    } else {
+        std::uint32_t dateMin = 0, dateMax = 0xFFFFFFFF;
+        if (args.options.count("--from") && (dateMin = borneDate(option(args, "--from"), false)) == 0) {
+            return erreurUsage("--from attend JJ/MM/AAAA ou AAAA");
+        }
+        if (args.options.count("--to") && (dateMax = borneDate(option(args, "--to"), true)) == 0) {
+            return erreurUsage("--to attend JJ/MM/AAAA ou AAAA");
+        }
+        if (!args.options.count("--genre") && !args.options.count("--language")) {
+            // Dates seules : index trié, résultats du plus ancien au plus récent
+            parDate = livresEntreDates(lib, dateMin, dateMax);
+            utiliseTranche = true;
+        } else {
+            FiltreLivres filtre;
+            filtre.dateMin = dateMin;
+            filtre.dateMax = dateMax;
+            bool connu = true;
+            if (args.options.count("--genre")) connu = (filtre.genre = chercherValeur(lib.books.genres, option(args, "--genre"))) >= 0;
+            if (connu && args.options.count("--language")) connu = (filtre.langue = chercherValeur(lib.books.langues, option(args, "--language"))) >= 0;
+            if (connu) positions = filtrerLivres(lib, filtre); // Genre ou langue inconnus : aucun résultat
+        }
+    }
+
+    std::size_t nombre = utiliseTranche ? parDate.size() : positions.size();
+    if (nombre > maximum) nombre = maximum;
+
+    if (json) std::cout << "{\"nombre\":" << nombre << ",\"livres\":[";
+    else std::cout << "ISBN;Titre;Langue;Auteurs;Date;Genre;Description\n";
+    for (std::size_t i = 0; i < nombre; i++) {
+        LivreVue livre = lib.books[utiliseTranche ? parDate.debut[i].livre : positions[i]];
+        if (json) {
+            std::cout << (i > 0 ? ",\n" : "\n");
+            ecrireLivreJSON(std::cout, livre);
+        } else {
+            ecrireLivreCSV(std::cout, livre);
+        }
+    }
+    if (json) std::cout << "\n]}\n";
+    return SORTIE_OK;
+}
+
+// Nombre de livres par valeur d'un dictionnaire (genres ou langues)
+static std::vector<std::size_t> compterParValeur(const Library& lib, bool parGenre) {
+    const Dictionnaire& dico = parGenre ? lib.books.genres : lib.books.langues;
+    std::vector<std::size_t> compte(dico.valeurs.size(), 0);
+    for (const LivreCompact& l : lib.books.livres) compte[parGenre ? l.genre : l.langue]++;
+    return compte;
+}
+
+static int commandeStats(const Arguments& args, const std::string& fichierDb) {
+    const bool json = args.drapeaux.count("--json") > 0;
+    Library lib;
+    if (!chargerPourCommande(lib, fichierDb, false)) return SORTIE_ERREUR;
+
+    TrancheDates datees = livresEntreDates(lib, 0, 0xFFFFFFFF);
+    std::uint32_t plusAncienne = datees.empty() ? 0 : datees.debut->date;
+    std::uint32_t plusRecente = datees.empty() ? 0 : (datees.fin - 1)->date;
+
+    if (json) {
+        std::cout << "{\"nom\":"; ecrireChaineJSON(std::cout, lib.name);
+        std::cout << ",\"livres\":" << lib.books.size()
+                  << ",\"format\":\"" << (lib.formatBinaire ? "binaire" : "texte") << "\""
+                  << ",\"sans_date\":" << lib.books.size() - datees.size()
+                  << ",\"date_min\":" << plusAncienne << ",\"date_max\":" << plusRecente;
+    } else {
+        std::cout << "nom;" << lib.name << "\n"
+                  << "livres;" << lib.books.size() << "\n"
+                  << "format;" << (lib.formatBinaire ? "binaire" : "texte") << "\n"
+                  << "sans_date;" << lib.books.size() - datees.size() << "\n"
+                  << "date_min;" << plusAncienne << "\n"
+                  << "date_max;" << plusRecente << "\n";
+    }
+
+    for (bool parGenre : {true, false}) {
+        const Dictionnaire& dico = parGenre ? lib.books.genres : lib.books.langues;
+        std::vector<std::size_t> compte = compterParValeur(lib, parGenre);
+        if (json) {
+            std::cout << (parGenre ? ",\"genres\":{" : ",\"langues\":{");
+            for (std::size_t i = 0; i < compte.size(); i++) {
+                if (i > 0) std::cout << ',';
+                ecrireChaineJSON(std::cout, dico.valeurs[i]);
+                std::cout << ':' << compte[i];
+            }
+            std::cout << '}';
+        } else {
+            for (std::size_t i = 0; i < compte.size(); i++) {
+                std::cout << (parGenre ? "genre;" : "langue;") << dico.valeurs[i] << ";" << compte[i] << "\n";
+            }
+        }
+    }
+    if (json) std::cout << "}\n";
+    return SORTIE_OK;
+}
+
+int executerCommande(int argc, char* argv[]) {
+    // Sortie faite pour être lue par un programme : pas de synchronisation avec printf
+    std::ios::sync_with_stdio(false);
+
+    Arguments args = decouperArguments(argc, argv);
+    if (args.commande == "help" || args.commande == "--help" || args.drapeaux.count("--help")) {
+        afficherAide();
+        return SORTIE_OK;
+    }
+    if (!args.erreur.empty()) return erreurUsage(args.erreur);
+
+    const std::string fichierDb = option(args, "--db", "library.db");
+    if (args.commande == "import") return commandeImport(args, fichierDb);
+    if (args.commande == "export-html") return commandeExport(args, fichierDb);
+    if (args.commande == "search") return commandeRecherche(args, fichierDb);
+    if (args.commande == "stats") return commandeStats(args, fichierDb);
+    return erreurUsage("commande inconnue '" + args.commande + "'");
+}
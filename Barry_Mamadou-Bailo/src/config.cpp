@@ -8,9 +8,12 @@
  * le logo ASCII personnalisé et les préférences d'affichage (pagination).
  */
 
+#include <algorithm> // Pour std::max
 #include <fstream> // Pour ifstream (lecture) et ofstream (écriture)
 #include <iostream>
+#include <sstream> // Pour préparer le contenu avant l'écriture (et lire la ligne des réglages)
 #include "config.hpp"
+#include "fichier_atomique.hpp" // Écriture par fichier temporaire
 #include "utils.hpp" // Pour récupérer les constantes de couleurs (RED, GREEN...)
 
 // Fonction pour redessiner le logo par défaut (hardcodé dans le programme)
@@ -43,6 +46,7 @@ void reinitialiserLogo(AppConfig& config) {
 // Initialise la configuration avec des valeurs de base si aucun fichier n'existe
 void creerConfigDefaut(AppConfig& config) {
     config.livresParPage = 10; // Par défaut, on affiche 10 livres par page
+    config.threadsImport = 0;  // Import : autant de threads que de cœurs
     reinitialiserLogo(config); // On charge le dessin du logo
 }
 
@@ -58,8 +62,16 @@ bool chargerConfig(AppConfig& config, const std::string& filename) {
     
     // IMPORTANT : Après avoir lu un entier avec >>, le caractère de saut de ligne (\n)
     // reste bloqué dans le buffer. Si on ne l'enlève pas, le prochain getline lira une ligne vide.
-    std::string dummy;
-    std::getline(fichier, dummy); // On "consomme" le reste de la ligne inutile
+    // Le reste de la ligne peut contenir le nombre de threads d'import, puis les deux réglages
+    // des statistiques de performance (0 ou 1) : absents des anciens fichiers.
+    std::string resteLigne;
+    std::getline(fichier, resteLigne);
+    std::istringstream reglages(resteLigne);
+    int threads = 0, mesures = 0, mesuresEnFichier = 0;
+    reglages >> threads >> mesures >> mesuresEnFichier; // Valeur illisible ou absente : 0 (automatique, désactivé)
+    config.threadsImport = std::max(0, threads);
+    config.mesures = (mesures != 0);
+    config.mesuresEnFichier = (mesuresEnFichier != 0);
 
     // 2. Lire le logo (tout le reste du fichier ligne par ligne)
     config.logo = "";
@@ -73,13 +85,16 @@ bool chargerConfig(AppConfig& config, const std::string& filename) {
 }
 
 void sauvegarderConfig(const AppConfig& config, const std::string& filename) {
-    // ofstream = Output File Stream (Flux de fichier en Sortie/Écriture)
-    std::ofstream fichier(filename);
-    
-    if (fichier) {
-        // On écrit d'abord les paramètres simples
-        fichier << config.livresParPage << std::endl;
-        // Puis on écrit le gros bloc de texte du logo
-        fichier << config.logo; 
+    // On prépare tout le contenu en mémoire, puis on remplace le fichier d'un seul coup
+    // (fichier temporaire + renommage) : un arrêt pendant l'écriture ne peut plus
+    // laisser un app.conf à moitié écrit.
+    std::ostringstream contenu;
+    // On écrit d'abord les paramètres simples
+    contenu << config.livresParPage << " " << config.threadsImport << " " << config.mesures << " " << config.mesuresEnFichier << "\n";
+    // Puis on écrit le gros bloc de texte du logo
+    contenu << config.logo;
+
+    if (!ecrireFichierAtomique(filename, contenu.str())) {
+        std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename << std::endl;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,213 @@
+/**
+ * @file csv.cpp
+ * @brief Découpage CSV sans allocation (voir csv.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <cstring> // Pour std::memmove et std::memchr
+#include "csv.hpp"
+
+const char* trouverFinEnregistrement(const char* debut, const char* fin, char separateur, bool finDeFlux) {
+    bool debutChamp = true;       // Un guillemet n'ouvre un champ protégé qu'en début de champ
+    bool dansGuillemets = false;
+
+    for (const char* p = debut; p < fin; p++) {
+        char c = *p;
+        if (dansGuillemets) {
+            if (c != '"') continue;
+            // Un guillemet en fin de tampon : impossible de savoir s'il est doublé sans lire la suite
+            if (p + 1 == fin) return finDeFlux ? fin : nullptr;
+            if (p[1] == '"') p++;           // "" = guillemet échappé, on reste dans le champ
+            else dansGuillemets = false;    // Guillemet fermant
+        } else if (c == '"' && debutChamp) {
+            dansGuillemets = true;
+        } else if (c == separateur) {
+            debutChamp = true;
+            continue;
+        } else if (c == '\n') {
+            return p;
+        }
+        debutChamp = false;
+    }
+    // Pas de '\n' trouvé : c'est la dernière ligne seulement si le fichier est terminé
+    return (finDeFlux && debut < fin) ? fin : nullptr;
+}
+
+std::size_t derniereFinEnregistrement(const char* debut, const char* fin, char separateur) {
+    // Cas courant : aucun guillemet dans le bloc, le dernier '\n' est forcément une fin de ligne
+    if (std::memchr(debut, '"', fin - debut) == nullptr) {
+        for (const char* p = fin; p > debut; p--) {
+            if (p[-1] == '\n') return p - debut;
+        }
+        return 0;
+    }
+    // Sinon il faut suivre les guillemets depuis le début du bloc
+    std::size_t derniere = 0;
+    const char* p = debut;
+    while (const char* finEnreg = trouverFinEnregistrement(p, fin, separateur, false)) {
+        p = finEnreg + 1;
+        derniere = p - debut;
+    }
+    return derniere;
+}
+
+void decouperEnregistrement(char* debut, char* fin, char separateur, std::vector<std::string_view>& champs) {
+    champs.clear();
+    // Fin de ligne Windows : on ignore le '\r' final
+    if (fin > debut && fin[-1] == '\r') fin--;
+
+    char* p = debut;
+    while (true) {
+        char* debutChamp = p;
+        char* ecriture = p;
+
+        if (p < fin && *p == '"') {
+            // Champ protégé : on recopie le contenu vers la gauche en remplaçant "" par "
+            p++;
+            debutChamp = ecriture = p;
+            while (p < fin) {
+                if (*p == '"') {
+                    if (p + 1 < fin && p[1] == '"') {
+                        *ecriture++ = '"';
+                        p += 2;
+                        continue;
+                    }
+                    p++; // Guillemet fermant
+                    break;
+                }
+                *ecriture++ = *p++;
+            }
+            // Caractères éventuels entre le guillemet fermant et le séparateur (fichier mal formé) : gardés
+            while (p < fin && *p != separateur) *ecriture++ = *p++;
+        } else {
+            while (p < fin && *p != separateur) p++;
+            ecriture = p;
+        }
+
+        champs.emplace_back(debutChamp, static_cast<std::size_t>(ecriture - debutChamp));
+
+        if (p >= fin) break;
+        p++; // On saute le séparateur
+    }
+}
+
+void ouvrirLecteurCSV(LecteurCSV& lecteur, std::istream& flux, char separateur, bool guillemets) {
+    lecteur.flux = &flux;
+    lecteur.separateur = separateur;
+    lecteur.guillemets = guillemets;
+    if (lecteur.tampon.size() < TAILLE_TAMPON_CSV) lecteur.tampon.resize(TAILLE_TAMPON_CSV);
+    lecteur.debut = 0;
+    lecteur.fin = 0;
+    lecteur.finDeFlux = false;
+    lecteur.decalage = 0;
+}
+
+// Complète le tampon avec la suite du fichier (après avoir ramené les données restantes au début)
+static void remplirTampon(LecteurCSV& lecteur) {
+    std::size_t reste = lecteur.fin - lecteur.debut;
+    if (lecteur.debut > 0) {
+        std::memmove(lecteur.tampon.data(), lecteur.tampon.data() + lecteur.debut, reste);
+        lecteur.decalage += lecteur.debut;
+        lecteur.debut = 0;
+        lecteur.fin = reste;
+    }
+    // Enregistrement plus grand que le tampon : on l'agrandit
+    if (lecteur.fin == lecteur.tampon.size()) lecteur.tampon.resize(lecteur.tampon.size() * 2);
+
+    lecteur.flux->read(lecteur.tampon.data() + lecteur.fin, lecteur.tampon.size() - lecteur.fin);
+    std::size_t lus = static_cast<std::size_t>(lecteur.flux->gcount());
+    lecteur.fin += lus;
+    if (lus == 0) lecteur.finDeFlux = true;
+}
+
+// Sans guillemets : la fin de ligne suivante (mêmes conventions que trouverFinEnregistrement)
+static const char* trouverFinLigne(const char* debut, const char* fin, bool finDeFlux) {
+    const void* saut = std::memchr(debut, '\n', static_cast<std::size_t>(fin - debut));
+    if (saut != nullptr) return static_cast<const char*>(saut);
+    return (finDeFlux && debut < fin) ? fin : nullptr;
+}
+
+// Sans guillemets : on coupe à chaque séparateur, comme le faisait l'ancien chargement
+static void decouperLigne(char* debut, char* fin, char separateur, std::vector<std::string_view>& champs) {
+    champs.clear();
+    if (fin > debut && fin[-1] == '\r') fin--;
+    char* champ = debut;
+    for (char* p = debut; p < fin; p++) {
+        if (*p != separateur) continue;
+        champs.emplace_back(champ, static_cast<std::size_t>(p - champ));
+        champ = p + 1;
+    }
+    champs.emplace_back(champ, static_cast<std::size_t>(fin - champ));
+}
+
+bool lireEnregistrement(LecteurCSV& lecteur, std::vector<std::string_view>& champs) {
+    while (true) {
+        char* donnees = lecteur.tampon.data();
+        const char* finEnreg = lecteur.guillemets
+            ? trouverFinEnregistrement(donnees + lecteur.debut, donnees + lecteur.fin, lecteur.separateur, lecteur.finDeFlux)
+            : trouverFinLigne(donnees + lecteur.debut, donnees + lecteur.fin, lecteur.finDeFlux);
+        if (finEnreg != nullptr) {
+            char* debut = donnees + lecteur.debut;
+            char* fin = donnees + (finEnreg - donnees);
+            if (lecteur.guillemets) decouperEnregistrement(debut, fin, lecteur.separateur, champs);
+            else decouperLigne(debut, fin, lecteur.separateur, champs);
+            // On saute le '\n' (s'il y en a un : la dernière ligne peut ne pas en avoir)
+            lecteur.debut = (fin < donnees + lecteur.fin) ? (fin - donnees) + 1 : lecteur.fin;
+            return true;
+        }
+        if (lecteur.finDeFlux) return false;
+        remplirTampon(lecteur);
+    }
+}
+
+std::uint64_t positionLecteurCSV(const LecteurCSV& lecteur) {
+    return lecteur.decalage + lecteur.debut;
+}
+
+void ecrireChampCSV(std::ostream& sortie, std::string_view champ, char separateur) {
+    bool aProteger = false;
+    for (char c : champ) {
+        if (c == separateur || c == '"' || c == '\n' || c == '\r') {
+            aProteger = true;
+            break;
+        }
+    }
+    if (!aProteger) {
+        sortie << champ;
+        return;
+    }
+    // Champ entre guillemets, les guillemets internes sont doublés
+    sortie << '"';
+    for (char c : champ) {
+        if (c == '"') sortie << '"';
+        sortie << c;
+    }
+    sortie << '"';
+}
+
+void ecrireChampCSV(TamponSortie& sortie, std::string_view champ, char separateur) {
+    // Simple boucle de comparaisons (find_first_of ferait un appel de fonction par caractère)
+    bool aProteger = false;
+    for (char c : champ) {
+        if (c == separateur || c == '"' || c == '\n' || c == '\r') {
+            aProteger = true;
+            break;
+        }
+    }
+    if (!aProteger) {
+        ecrire(sortie, champ);
+        return;
+    }
+    // Champ entre guillemets : on copie par morceaux, en doublant chaque guillemet
+    ecrire(sortie, "\"");
+    std::size_t debut = 0;
+    for (std::size_t guillemet = champ.find('"'); guillemet != std::string_view::npos;
+         guillemet = champ.find('"', guillemet + 1)) {
+        ecrire(sortie, champ.substr(debut, guillemet + 1 - debut));
+        ecrire(sortie, "\"");
+        debut = guillemet + 1;
+    }
+    ecrire(sortie, champ.substr(debut));
+    ecrire(sortie, "\"");
+}
@@ -0,0 +1,39 @@
+/**
+ * @file curseur.cpp
+ * @brief Parcours à la demande du catalogue (voir curseur.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <utility> // Pour std::move
+#include "curseur.hpp"
+
+CurseurRecherche ouvrirCurseur(const CatalogueCompact& livres, std::function<bool(const LivreVue&)> correspond) {
+    CurseurRecherche curseur;
+    curseur.livres = &livres;
+    curseur.correspond = std::move(correspond);
+    return curseur;
+}
+
+CurseurRecherche curseurResultats(const CatalogueCompact& livres, std::vector<std::uint32_t> positions) {
+    CurseurRecherche curseur;
+    curseur.livres = &livres;
+    curseur.prochain = livres.size();
+    curseur.trouves = std::move(positions);
+    return curseur;
+}
+
+std::size_t avancerCurseur(CurseurRecherche& curseur, std::size_t nombre) {
+    const CatalogueCompact& livres = *curseur.livres;
+    while (curseur.trouves.size() < nombre && curseur.prochain < livres.size()) {
+        if (curseur.correspond(livres[curseur.prochain])) {
+            curseur.trouves.push_back(static_cast<std::uint32_t>(curseur.prochain));
+        }
+        curseur.prochain++;
+    }
+    return curseur.trouves.size();
+}
+
+bool curseurTermine(const CurseurRecherche& curseur) {
+    return curseur.prochain >= curseur.livres->size();
+}
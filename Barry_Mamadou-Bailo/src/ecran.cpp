@@ -0,0 +1,252 @@
+/**
+ * @file ecran.cpp
+ * @brief Rendu des menus par écran entier (voir ecran.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <cstdio>   // Pour std::fwrite (Windows)
+#include <cstdlib>  // Pour std::atexit
+#include <iostream>
+#include <mutex>    // Un message d'erreur peut venir du thread de compactage (journal.cpp)
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include "ecran.hpp"
+
+#ifndef _WIN32
+    #include <sys/ioctl.h> // Taille du terminal (TIOCGWINSZ)
+    #include <unistd.h>    // write(), isatty()
+#endif
+
+// \033[2J : efface tout l'écran ; \033[1;1H : curseur en haut à gauche
+static const std::string EFFACER = "\033[2J\033[1;1H";
+
+static bool installe = false;
+static std::string enAttente;     // Texte écrit dans std::cout depuis le dernier envoi
+static bool nouvelEcran = false;  // enAttente commence un nouvel écran (effacement à décider)
+static std::string ecranAffiche;  // Dernier écran envoyé depuis son début
+static bool ecranIntact = false;  // Le terminal montre encore ecranAffiche, à partir de la 1re ligne
+static int saisiesDepuis = 0;     // Lectures de std::cin depuis (chacune peut ajouter une ligne)
+static std::string envoi;         // Tampon de l'envoi (réutilisé)
+
+// Protège tout l'état ci-dessus. std::cerr est attaché au rendu : un message d'erreur du
+// thread de compactage (ex: réécriture impossible) envoie l'écran en attente depuis ce
+// thread, pendant que le menu continue d'écrire dans std::cout.
+static std::mutex verrouEcran;
+
+// Un seul appel système pour tout le texte (sauf si le terminal n'accepte qu'une partie)
+static void ecrireTerminal(const std::string& texte) {
+#ifdef _WIN32
+    std::fwrite(texte.data(), 1, texte.size(), stdout);
+    std::fflush(stdout);
+#else
+    std::size_t ecrit = 0;
+    while (ecrit < texte.size()) {
+        ssize_t n = ::write(STDOUT_FILENO, texte.data() + ecrit, texte.size() - ecrit);
+        if (n <= 0) return; // Terminal fermé : rien à faire de plus
+        ecrit += static_cast<std::size_t>(n);
+    }
+#endif
+}
+
+// Taille du terminal en lignes et colonnes (0 si la sortie n'est pas un terminal)
+struct TailleTerminal {
+    int lignes = 0;
+    int colonnes = 0;
+};
+
+static TailleTerminal tailleTerminal() {
+    TailleTerminal taille;
+#ifndef _WIN32
+    struct winsize ws;
+    if (isatty(STDOUT_FILENO) && ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0 && ws.ws_row > 0 && ws.ws_col > 0) {
+        taille.lignes = ws.ws_row;
+        taille.colonnes = ws.ws_col;
+    }
+#endif
+    return taille;
+}
+
+// Nombre de colonnes occupées par une ligne à l'écran : les codes couleur (\033[...m) ne
+// prennent pas de place, un caractère UTF-8 en prend une, un emoji ou un idéogramme deux.
+static int largeurAffichee(std::string_view ligne) {
+    int largeur = 0;
+    std::size_t i = 0;
+    while (i < ligne.size()) {
+        unsigned char c = static_cast<unsigned char>(ligne[i]);
+        if (c == '\033') { // Séquence ANSI : jusqu'à la lettre finale
+            i += 2;
+            while (i < ligne.size() && (ligne[i] < '@' || ligne[i] > '~')) i++;
+            i++;
+            continue;
+        }
+        // Décodage du caractère UTF-8
+        std::size_t longueur = (c < 0x80) ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : 4;
+        unsigned long point = (longueur == 1) ? c : (c & (0x7F >> longueur));
+        for (std::size_t k = 1; k < longueur && i + k < ligne.size(); k++) point = (point << 6) | (ligne[i + k] & 0x3F);
+        i += longueur;
+
+        if (point == 0xFE0F || point == 0x200D || (point >= 0x300 && point < 0x370)) continue; // Sans largeur
+        bool large = (point >= 0x1F000 && point < 0x1FB00) || (point >= 0x2600 && point < 0x27C0)
+                     || (point >= 0x1100 && point < 0x1160) || (point >= 0x2E80 && point < 0xA4D0)
+                     || (point >= 0xAC00 && point < 0xD7A4) || (point >= 0xF900 && point < 0xFB00)
+                     || (point >= 0xFF00 && point < 0xFF61);
+        largeur += large ? 2 : 1;
+    }
+    return largeur;
+}
+
+// Nombre de lignes du terminal occupées par un texte écrit depuis la première colonne
+// (les lignes trop longues passent à la ligne ; la ligne du curseur compte aussi)
+static int hauteurAffichee(std::string_view texte, int colonnes) {
+    int hauteur = 0;
+    std::size_t debut = 0;
+    while (true) {
+        std::size_t fin = texte.find('\n', debut);
+        int largeur = largeurAffichee(texte.substr(debut, fin == std::string_view::npos ? std::string_view::npos : fin - debut));
+        hauteur += (largeur == 0) ? 1 : (largeur + colonnes - 1) / colonnes;
+        if (fin == std::string_view::npos) return hauteur;
+        debut = fin + 1;
+    }
+}
+
+// Envoie un écran complet (enAttente commence par un nouvel écran)
+static void envoyerNouvelEcran() {
+    TailleTerminal taille = tailleTerminal();
+
+    // Lignes identiques au début des deux écrans : déjà à leur place si l'écran affiché
+    // n'a pas défilé. On s'arrête avant une ligne assez longue pour avoir pu passer à la
+    // ligne (sa hauteur exacte dépend du terminal) : la position du curseur doit être sûre.
+    std::size_t commun = 0;
+    int lignesCommunes = 0;
+    if (ecranIntact && taille.lignes > 0
+        && hauteurAffichee(ecranAffiche, taille.colonnes) + saisiesDepuis <= taille.lignes) {
+        while (true) {
+            std::size_t fin = enAttente.find('\n', commun);
+            if (fin == std::string::npos) break;
+            std::size_t longueur = fin + 1 - commun;
+            if (commun + longueur > ecranAffiche.size()
+                || ecranAffiche.compare(commun, longueur, enAttente, commun, longueur) != 0
+                || largeurAffichee(std::string_view(enAttente).substr(commun, longueur - 1)) > taille.colonnes - 4) break;
+            commun = fin + 1;
+            lignesCommunes++;
+        }
+    }
+
+    if (lignesCommunes > 0) {
+        // Curseur sous la dernière ligne commune, puis effacement jusqu'en bas de l'écran
+        envoi = "\033[" + std::to_string(lignesCommunes + 1) + ";1H\033[J";
+    } else {
+        envoi = EFFACER;
+    }
+    envoi.append(enAttente, commun, std::string::npos);
+    ecrireTerminal(envoi);
+
+    ecranAffiche.swap(enAttente); // L'ancien écran devient le tampon suivant (capacité gardée)
+    ecranIntact = (taille.lignes > 0);
+    saisiesDepuis = 0;
+}
+
+// À appeler avec verrouEcran déjà pris
+static void envoyer(bool avantSaisie) {
+    if (nouvelEcran) {
+        envoyerNouvelEcran();
+    } else if (!enAttente.empty()) {
+        // Du texte s'ajoute sous l'écran (message, saisie...) : il peut le faire défiler
+        ecrireTerminal(enAttente);
+        ecranIntact = false;
+    }
+    enAttente.clear();
+    nouvelEcran = false;
+    if (avantSaisie) saisiesDepuis++;
+}
+
+// Tampon de std::cout : tout s'ajoute à enAttente, std::endl (sync) ne vide plus rien
+struct TamponEcran : std::streambuf {
+    int_type overflow(int_type c) override {
+        std::lock_guard<std::mutex> verrou(verrouEcran);
+        if (!traits_type::eq_int_type(c, traits_type::eof())) enAttente.push_back(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+    std::streamsize xsputn(const char* texte, std::streamsize n) override {
+        std::lock_guard<std::mutex> verrou(verrouEcran);
+        enAttente.append(texte, static_cast<std::size_t>(n));
+        return n;
+    }
+    int sync() override { return 0; }
+};
+
+// Flux "attachés" (tie) à std::cin et std::cerr : ils sont vidés avant chaque lecture au
+// clavier ou message d'erreur, ce qui envoie l'écran en attente.
+struct EnvoiAvantSaisie : std::streambuf {
+    int sync() override {
+        std::lock_guard<std::mutex> verrou(verrouEcran);
+        envoyer(true);
+        return 0;
+    }
+};
+struct EnvoiAvantErreur : std::streambuf {
+    int sync() override {
+        std::lock_guard<std::mutex> verrou(verrouEcran);
+        envoyer(false);
+        ecranIntact = false; // Le message s'écrit sous l'écran
+        return 0;
+    }
+};
+
+static TamponEcran tamponEcran;
+static EnvoiAvantSaisie envoiAvantSaisie;
+static EnvoiAvantErreur envoiAvantErreur;
+static std::ostream fluxSaisie(&envoiAvantSaisie);
+static std::ostream fluxErreur(&envoiAvantErreur);
+static std::streambuf* tamponOrigine = nullptr;
+
+// Fin du programme (retour de main ou std::exit) : dernier envoi, puis std::cout retrouve
+// son tampon d'origine (les nôtres sont détruits avant lui).
+static void terminerRenduEcran() {
+    {
+        std::lock_guard<std::mutex> verrou(verrouEcran);
+        envoyer(false);
+    }
+    std::cout.rdbuf(tamponOrigine);
+    std::cin.tie(&std::cout);
+    std::cerr.tie(&std::cout);
+}
+
+void installerRenduEcran() {
+    if (installe) return;
+    installe = true;
+    std::cout.flush();
+    enAttente.reserve(1 << 16);
+    tamponOrigine = std::cout.rdbuf(&tamponEcran);
+    std::cin.tie(&fluxSaisie);
+    std::cerr.tie(&fluxErreur);
+    std::atexit(terminerRenduEcran);
+}
+
+void effacerEcran() {
+    if (!installe) {
+        std::cout << EFFACER;
+        return;
+    }
+    std::lock_guard<std::mutex> verrou(verrouEcran);
+    if (enAttente.empty()) {
+        nouvelEcran = true; // L'effacement (complet ou non) sera décidé à l'envoi
+    } else {
+        // Du texte attend encore avant cet écran : on efface simplement, comme avant
+        if (nouvelEcran) enAttente.insert(0, EFFACER); // L'écran précédent, jamais envoyé, aussi
+        nouvelEcran = false;
+        enAttente += EFFACER;
+        ecranIntact = false;
+    }
+}
+
+void envoyerEcran() {
+    if (!installe) {
+        std::cout.flush();
+        return;
+    }
+    std::lock_guard<std::mutex> verrou(verrouEcran);
+    envoyer(false);
+}
@@ -0,0 +1,356 @@
+/**
+ * @file export_html.cpp
+ * @brief Export du catalogue en page Web (HTML), trié par titre.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Voir export_html.hpp pour le principe du tri et tampon_sortie.hpp pour l'écriture.
+ */
+
+#include <algorithm> // Pour std::sort
+#include <atomic>
+#include <filesystem> // Pour créer le dossier de l'export en plusieurs fichiers
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include "export_html.hpp"
+#include "mesures.hpp"   // Statistiques de performance (Paramètres)
+#include "tampon_sortie.hpp"
+
+// majuscule, longueurArticle et comparerTitres sont dans index_tris.hpp : le tri par titre
+// du menu (index persistant) et celui de l'export donnent ainsi exactement le même ordre.
+
+// Nettoie le titre pour le tri alphabétique (enlève "Le", "La", met en majuscule...)
+std::string nettoyerTitrePourTri(std::string_view titre) {
+    std::string s(titre.substr(longueurArticle(titre)));
+    for (auto& c : s) c = static_cast<char>(majuscule(c));
+    return s;
+}
+
+std::vector<CleTri> trierParTitre(const Library& lib) {
+    // 1. On repère l'article de chaque livre (une fois), sans copier les livres ni les titres
+    std::vector<CleTri> livresTries(lib.books.size());
+    for (std::size_t i = 0; i < lib.books.size(); i++) {
+        livresTries[i].position = static_cast<std::uint32_t>(i);
+        livresTries[i].debutCle = longueurArticle(lib.books[i].title);
+    }
+
+    // 2. On trie les positions : les comparaisons ne font aucune allocation.
+    // À clé égale, on garde l'ordre du catalogue pour que l'export soit toujours identique.
+    std::sort(livresTries.begin(), livresTries.end(), [&lib](const CleTri& a, const CleTri& b) {
+        int diff = comparerTitres(lib.books[a.position].title, a.debutCle, lib.books[b.position].title, b.debutCle);
+        if (diff != 0) return diff < 0;
+        return a.position < b.position;
+    });
+    return livresTries;
+}
+
+char lettreSection(const Library& lib, const CleTri& livre) {
+    std::string_view titre = lib.books[livre.position].title;
+    if (livre.debutCle >= titre.size()) return '#';
+    unsigned char lettre = majuscule(titre[livre.debutCle]);
+    return (lettre >= 'A' && lettre <= 'Z') ? static_cast<char>(lettre) : '#';
+}
+
+// === MORCEAUX COMMUNS AUX PAGES ===
+
+// Début de page : en-tête HTML, CSS intégré, nom et sous-titre de la bibliothèque
+static void ecrireDebutPage(TamponSortie& sortie, const Library& lib, std::string_view sousTitre) {
+    // Écriture de l'en-tête HTML standard
+    ecrire(sortie, "<!DOCTYPE html>\n");
+    ecrire(sortie, "<html lang='fr'>\n");
+    ecrire(sortie, "<head>\n");
+    ecrire(sortie, "<meta charset='UTF-8'>\n");
+    ecrire(sortie, "<meta name='viewport' content='width=device-width, initial-scale=1.0'>\n");
+    ecrire(sortie, "<title>");
+    ecrireEchappeHTML(sortie, lib.name);
+    ecrire(sortie, " - Catalogue</title>\n");
+
+    // CSS Intégré (Pour que le fichier HTML soit autonome et joli)
+    ecrire(sortie, "<style>\n");
+    ecrire(sortie, "body { font-family: sans-serif; background-color: #f4f4f9; color: #333; margin: 20px; }\n");
+    ecrire(sortie, ".container { max-width: 900px; margin: 0 auto; background: white; padding: 20px; box-shadow: 0 0 10px rgba(0,0,0,0.1); }\n");
+    ecrire(sortie, "h1 { text-align: center; color: #2c3e50; }\n");
+    ecrire(sortie, ".subtitle { text-align: center; color: #7f8c8d; font-style: italic; margin-bottom: 30px; }\n");
+
+    // Style de la barre d'index (A B C D...)
+    ecrire(sortie, ".index-bar { text-align: center; margin-bottom: 20px; }\n");
+    ecrire(sortie, ".index-bar a { display: inline-block; padding: 5px 10px; margin: 2px; text-decoration: none; color: white; background-color: #3498db; border-radius: 4px; }\n");
+
+    // Style des cartes de livres
+    ecrire(sortie, "h2 { border-bottom: 2px solid #3498db; color: #3498db; margin-top: 30px; }\n");
+    ecrire(sortie, ".livre-card { border-left: 5px solid #3498db; padding: 10px 15px; margin-bottom: 15px; background: #f9f9f9; }\n");
+    ecrire(sortie, ".livre-titre { font-weight: bold; font-size: 1.1em; }\n");
+    ecrire(sortie, ".livre-infos { font-size: 0.9em; color: #555; }\n");
+    ecrire(sortie, ".pagination { text-align: center; margin: 20px 0; }\n");
+    ecrire(sortie, "</style>\n");
+    ecrire(sortie, "</head>\n");
+
+    ecrire(sortie, "<body>\n");
+    ecrire(sortie, "<div class='container'>\n");
+    ecrire(sortie, "<h1>");
+    ecrireEchappeHTML(sortie, lib.name);
+    ecrire(sortie, "</h1>\n");
+    ecrire(sortie, "<p class='subtitle'>");
+    ecrireEchappeHTML(sortie, sousTitre);
+    ecrire(sortie, "</p>\n");
+}
+
+static void ecrireFinPage(TamponSortie& sortie) {
+    ecrire(sortie, "</div>\n"); // Fin container
+    ecrire(sortie, "</body></html>\n");
+}
+
+// Barre d'index alphabétique : un lien par lettre présente.
+// 'lienLettre' donne la cible du lien (ancre dans la page, ou fichier de la lettre).
+template <typename Lien>
+static void ecrireBarreIndex(TamponSortie& sortie, const std::string& lettresPresentes, Lien lienLettre) {
+    ecrire(sortie, "<div class='index-bar'>\n");
+    for (char c : ALPHABET_SECTIONS) {
+        if (lettresPresentes.find(c) != std::string::npos) {
+            ecrire(sortie, "<a href='");
+            ecrire(sortie, lienLettre(c));
+            ecrire(sortie, "'>");
+            ecrire(sortie, std::string_view(&c, 1));
+            ecrire(sortie, "</a>");
+        } else {
+            ecrire(sortie, "<span>");
+            ecrire(sortie, std::string_view(&c, 1));
+            ecrire(sortie, "</span>");
+        }
+    }
+    ecrire(sortie, "</div>\n");
+}
+
+// Titre de section (une lettre)
+static void ecrireSection(TamponSortie& sortie, char lettre) {
+    ecrire(sortie, "<h2 id='section-");
+    ecrire(sortie, std::string_view(&lettre, 1));
+    ecrire(sortie, "'>");
+    ecrire(sortie, std::string_view(&lettre, 1));
+    ecrire(sortie, "</h2>\n");
+}
+
+// Carte d'un livre, en échappant les champs au passage
+static void ecrireLivre(TamponSortie& sortie, const LivreVue& livre) {
+    ecrire(sortie, "<div class='livre-card'>\n");
+    ecrire(sortie, "<div class='livre-titre'>");
+    ecrireEchappeHTML(sortie, livre.title);
+    ecrire(sortie, "</div>\n");
+    ecrire(sortie, "<div class='livre-infos'>\n");
+    ecrire(sortie, "Par <strong>");
+    ecrireEchappeHTML(sortie, livre.authors);
+    ecrire(sortie, "</strong> &bull; ");
+    ecrire(sortie, "ISBN: ");
+    ecrireEchappeHTML(sortie, livre.isbn);
+    ecrire(sortie, " &bull; ");
+    ecrireEchappeHTML(sortie, livre.date);
+    ecrire(sortie, "\n");
+    ecrire(sortie, "</div>\n");
+    ecrire(sortie, "</div>\n");
+}
+
+// === FONCTION PRINCIPALE D'EXPORT ===
+
+bool exporterHTML(const Library& lib, const std::string& filename) {
+    MesureEnCours mesure(MESURE_EXPORT_HTML);
+    // 1. On trie un tableau de positions (on ne veut pas changer l'ordre dans l'application)
+    std::vector<CleTri> livresTries = trierParTitre(lib);
+
+    std::ofstream fichier(filename, std::ios::binary);
+    if (!fichier) {
+        std::cerr << "Erreur lors de la création du fichier HTML" << std::endl;
+        return false;
+    }
+    // Tout passe par un tampon de 1 Mo : une écriture par bloc au lieu d'un vidage par ligne
+    TamponSortie sortie;
+    ouvrirTamponSortie(sortie, fichier);
+
+    // 2. En-tête de la page
+    ecrireDebutPage(sortie, lib, lib.description);
+
+    // 3. Génération de l'index Alphabétique
+    std::string lettresPresentes = "";
+    // On repère quelles lettres sont utilisées
+    for (const auto& livre : livresTries) {
+        char premiereLettre = lettreSection(lib, livre);
+        if (lettresPresentes.find(premiereLettre) == std::string::npos) {
+            lettresPresentes += premiereLettre;
+        }
+    }
+    // On affiche les liens (ancres dans la page)
+    std::string ancre = "#section-?";
+    ecrireBarreIndex(sortie, lettresPresentes, [&](char c) -> std::string_view {
+        ancre.back() = c;
+        return ancre;
+    });
+
+    // 4. Génération du contenu (Livres)
+    char sectionActuelle = 0;
+    for (const auto& trie : livresTries) {
+        char lettre = lettreSection(lib, trie);
+
+        // Si on change de lettre, on crée une nouvelle section
+        if (lettre != sectionActuelle) {
+            sectionActuelle = lettre;
+            ecrireSection(sortie, sectionActuelle);
+        }
+        ecrireLivre(sortie, lib.books[trie.position]);
+    }
+
+    ecrireFinPage(sortie);
+    viderTamponSortie(sortie);
+    compterLignes(mesure, livresTries.size());
+    if (mesure.active) compterOctets(mesure, static_cast<std::uint64_t>(fichier.tellp()));
+
+    // Une écriture ratée (disque plein...) ne se voit qu'à la fermeture du fichier
+    fichier.close();
+    if (!fichier) {
+        std::cerr << "Erreur lors de l'écriture du fichier HTML" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// === EXPORT EN PLUSIEURS FICHIERS (UNE SECTION PAR LETTRE) ===
+
+std::string nomFichierPage(char lettre, int page) {
+    // '#' n'est pas pratique dans un nom de fichier (c'est le début d'une ancre dans une URL)
+    std::string nom = (lettre == '#') ? "autres" : std::string(1, lettre);
+    return "lettre-" + nom + "-" + std::to_string(page) + ".html";
+}
+
+// Une page à écrire : un morceau de la liste d'une lettre
+struct PageExport {
+    char lettre;
+    std::size_t debut, fin;  // Intervalle dans le tableau trié par lettre
+    int numero, nbPages;     // Numéro de la page (à partir de 1) et nombre de pages de la lettre
+};
+
+// Écrit une page de lettre. Retourne false si le fichier n'a pas pu être écrit.
+static bool ecrirePageLettre(const Library& lib, const std::string& dossier, const std::vector<CleTri>& parLettre,
+                             const PageExport& page, const std::string& lettresPresentes) {
+    std::ofstream fichier(dossier + "/" + nomFichierPage(page.lettre, page.numero), std::ios::binary);
+    if (!fichier) return false;
+    TamponSortie sortie;
+    ouvrirTamponSortie(sortie, fichier);
+
+    std::string sousTitre = std::string("Section ") + page.lettre + " - page " + std::to_string(page.numero)
+                          + " / " + std::to_string(page.nbPages);
+    ecrireDebutPage(sortie, lib, sousTitre);
+
+    std::string lien;
+    ecrireBarreIndex(sortie, lettresPresentes, [&](char c) -> std::string_view {
+        lien = nomFichierPage(c, 1);
+        return lien;
+    });
+
+    // Navigation entre les pages de la lettre
+    ecrire(sortie, "<div class='pagination'><a href='index.html'>Sommaire</a>");
+    if (page.numero > 1) {
+        ecrire(sortie, " &bull; <a href='" + nomFichierPage(page.lettre, page.numero - 1) + "'>&laquo; Page précédente</a>");
+    }
+    if (page.numero < page.nbPages) {
+        ecrire(sortie, " &bull; <a href='" + nomFichierPage(page.lettre, page.numero + 1) + "'>Page suivante &raquo;</a>");
+    }
+    ecrire(sortie, "</div>\n");
+
+    ecrireSection(sortie, page.lettre);
+    for (std::size_t i = page.debut; i < page.fin; i++) ecrireLivre(sortie, lib.books[parLettre[i].position]);
+
+    ecrireFinPage(sortie);
+    viderTamponSortie(sortie);
+    return static_cast<bool>(fichier);
+}
+
+int exporterHTMLParLettre(const Library& lib, const std::string& dossier, int livresParPage, int nbThreads) {
+    if (livresParPage <= 0) livresParPage = LIVRES_PAR_PAGE_HTML;
+    std::error_code erreur;
+    std::filesystem::create_directories(dossier, erreur);
+    if (erreur) {
+        std::cerr << "Erreur : Impossible de créer le dossier " << dossier << std::endl;
+        return -1;
+    }
+
+    // 1. Tri par titre, puis regroupement par lettre (en gardant l'ordre du tri dans chaque lettre).
+    // Les livres d'une lettre ne sont pas forcément voisins dans le tri : "123" et "Été" vont tous
+    // les deux dans la section '#', l'un avant 'A' et l'autre après 'Z'.
+    std::vector<CleTri> livresTries = trierParTitre(lib);
+    const std::size_t nbLettres = ALPHABET_SECTIONS.size();
+    std::vector<std::size_t> debutLettre(nbLettres + 1, 0);
+    for (const auto& l : livresTries) debutLettre[ALPHABET_SECTIONS.find(lettreSection(lib, l)) + 1]++;
+    for (std::size_t i = 0; i < nbLettres; i++) debutLettre[i + 1] += debutLettre[i];
+
+    std::vector<CleTri> parLettre(livresTries.size());
+    std::vector<std::size_t> ecriture(debutLettre.begin(), debutLettre.end() - 1);
+    for (const auto& l : livresTries) parLettre[ecriture[ALPHABET_SECTIONS.find(lettreSection(lib, l))]++] = l;
+    livresTries.clear();
+    livresTries.shrink_to_fit(); // On ne garde qu'un seul tableau d'indices
+
+    // 2. Liste des pages à écrire
+    std::string lettresPresentes;
+    std::vector<PageExport> pages;
+    for (std::size_t i = 0; i < nbLettres; i++) {
+        std::size_t nb = debutLettre[i + 1] - debutLettre[i];
+        if (nb == 0) continue;
+        lettresPresentes += ALPHABET_SECTIONS[i];
+        int nbPages = static_cast<int>((nb + livresParPage - 1) / livresParPage);
+        for (int p = 0; p < nbPages; p++) {
+            std::size_t debut = debutLettre[i] + static_cast<std::size_t>(p) * livresParPage;
+            std::size_t fin = std::min(debut + livresParPage, debutLettre[i + 1]);
+            pages.push_back({ALPHABET_SECTIONS[i], debut, fin, p + 1, nbPages});
+        }
+    }
+
+    // 3. Écriture des pages en parallèle : chaque thread prend la page suivante non encore écrite.
+    // Les pages sont indépendantes (un fichier chacune) : aucun verrou n'est nécessaire.
+    if (nbThreads <= 0) nbThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    nbThreads = std::max(1, std::min<int>(nbThreads, static_cast<int>(pages.size())));
+    std::atomic<std::size_t> suivante{0};
+    std::atomic<bool> echec{false};
+    auto travail = [&]() {
+        for (std::size_t i = suivante++; i < pages.size(); i = suivante++) {
+            if (!ecrirePageLettre(lib, dossier, parLettre, pages[i], lettresPresentes)) echec = true;
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nbThreads; t++) threads.emplace_back(travail);
+    travail(); // Le thread appelant travaille aussi
+    for (auto& t : threads) t.join();
+
+    // 4. Page d'accueil légère : une ligne par lettre avec les liens vers ses pages
+    std::ofstream fichier(dossier + "/index.html", std::ios::binary);
+    if (!fichier || echec) {
+        std::cerr << "Erreur lors de la création des fichiers HTML dans " << dossier << std::endl;
+        return -1;
+    }
+    TamponSortie sortie;
+    ouvrirTamponSortie(sortie, fichier);
+    ecrireDebutPage(sortie, lib, lib.description);
+    std::string lien;
+    ecrireBarreIndex(sortie, lettresPresentes, [&](char c) -> std::string_view {
+        lien = nomFichierPage(c, 1);
+        return lien;
+    });
+    ecrire(sortie, "<p class='subtitle'>" + std::to_string(lib.books.size()) + " livres</p>\n");
+    for (std::size_t i = 0; i < pages.size(); i++) {
+        const PageExport& page = pages[i];
+        if (page.numero == 1) {
+            ecrireSection(sortie, page.lettre);
+            std::size_t nb = debutLettre[ALPHABET_SECTIONS.find(page.lettre) + 1] - debutLettre[ALPHABET_SECTIONS.find(page.lettre)];
+            ecrire(sortie, "<p>" + std::to_string(nb) + " livre(s) : ");
+        }
+        ecrire(sortie, "<a href='" + nomFichierPage(page.lettre, page.numero) + "'>" + std::to_string(page.numero) + "</a> ");
+        if (page.numero == page.nbPages) ecrire(sortie, "</p>\n");
+    }
+    ecrireFinPage(sortie);
+    viderTamponSortie(sortie);
+
+    // Comme pour les pages : une écriture ratée ne se voit qu'à la fermeture
+    fichier.close();
+    if (!fichier) {
+        std::cerr << "Erreur lors de l'écriture de " << dossier << "/index.html" << std::endl;
+        return -1;
+    }
+    return static_cast<int>(pages.size()) + 1;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file facettes.cpp
+ * @brief Index des facettes genre / langue / décennie (voir facettes.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::sort
+#include <numeric>   // Pour std::iota
+#include "facettes.hpp"
+
+// Ensemble renvoyé pour une valeur inconnue (aucun livre)
+static const BitmapCompresse ENSEMBLE_VIDE;
+
+long decennieDe(std::uint32_t date) {
+    if (date == 0) return DECENNIE_INCONNUE;
+    return static_cast<long>(date / 10000 / 10 * 10);
+}
+
+// L'ensemble de la valeur 'numero' d'un genre ou d'une langue, créé s'il n'existe pas encore
+static BitmapCompresse& ensembleNumero(std::vector<BitmapCompresse>& ensembles, std::uint32_t numero) {
+    if (numero >= ensembles.size()) ensembles.resize(static_cast<std::size_t>(numero) + 1);
+    return ensembles[numero];
+}
+
+void indexerFacettes(IndexFacettes& index, std::uint32_t position, const LivreCompact& livre) {
+    ajouterPosition(ensembleNumero(index.genres, livre.genre), position);
+    ajouterPosition(ensembleNumero(index.langues, livre.langue), position);
+    ajouterPosition(index.decennies[decennieDe(livre.date)], position);
+    index.nombreLivres++;
+}
+
+void viderIndexFacettes(IndexFacettes& index) {
+    index = IndexFacettes();
+}
+
+void construireIndexFacettes(IndexFacettes& index, const CatalogueCompact& livres) {
+    if (index.construit) return;
+    viderIndexFacettes(index);
+    for (std::size_t i = 0; i < livres.size(); i++) {
+        indexerFacettes(index, static_cast<std::uint32_t>(i), livres.livres[i]);
+    }
+    index.construit = true;
+}
+
+bool selectionVide(const SelectionFacettes& selection) {
+    for (long choix : selection.choix) {
+        if (choix >= 0) return false;
+    }
+    return true;
+}
+
+// Les livres d'une valeur d'une facette
+static const BitmapCompresse& ensembleDe(const IndexFacettes& index, int facette, long valeur) {
+    if (facette == FACETTE_DECENNIE) {
+        auto trouve = index.decennies.find(valeur);
+        return trouve == index.decennies.end() ? ENSEMBLE_VIDE : trouve->second;
+    }
+    const std::vector<BitmapCompresse>& ensembles = (facette == FACETTE_GENRE) ? index.genres : index.langues;
+    if (valeur < 0 || static_cast<std::size_t>(valeur) >= ensembles.size()) return ENSEMBLE_VIDE;
+    return ensembles[static_cast<std::size_t>(valeur)];
+}
+
+// ET des choix de la sélection, sans celui de la facette 'ignoree' (NB_FACETTES : aucune).
+// Retourne nullptr s'il n'y a aucun choix (= tous les livres) ; avec un seul choix, c'est
+// l'ensemble de l'index lui-même (pas de copie), sinon le ET est rangé dans 'stockage'.
+static const BitmapCompresse* croiserChoix(const IndexFacettes& index, const SelectionFacettes& selection,
+                                           int ignoree, BitmapCompresse& stockage) {
+    const BitmapCompresse* resultat = nullptr;
+    for (int f = 0; f < NB_FACETTES; f++) {
+        if (f == ignoree || selection.choix[f] < 0) continue;
+        const BitmapCompresse& ensemble = ensembleDe(index, f, selection.choix[f]);
+        if (resultat == nullptr) {
+            resultat = &ensemble;
+        } else {
+            stockage = intersection(*resultat, ensemble);
+            resultat = &stockage;
+        }
+    }
+    return resultat;
+}
+
+std::vector<CompteFacette> compterFacette(const IndexFacettes& index, const SelectionFacettes& selection, Facette facette) {
+    BitmapCompresse stockage;
+    const BitmapCompresse* autres = croiserChoix(index, selection, facette, stockage);
+
+    // Les valeurs de la facette et leurs ensembles (std::map : décennies déjà dans l'ordre)
+    std::vector<long> valeurs;
+    std::vector<const BitmapCompresse*> ensembles;
+    if (facette == FACETTE_DECENNIE) {
+        for (const auto& decennie : index.decennies) {
+            valeurs.push_back(decennie.first);
+            ensembles.push_back(&decennie.second);
+        }
+    } else {
+        const std::vector<BitmapCompresse>& parNumero = (facette == FACETTE_GENRE) ? index.genres : index.langues;
+        for (std::size_t v = 0; v < parNumero.size(); v++) {
+            valeurs.push_back(static_cast<long>(v));
+            ensembles.push_back(&parNumero[v]);
+        }
+    }
+
+    // Sans autre choix, les nombres sont déjà connus ; sinon un ET compté, sans rien construire
+    std::vector<std::uint32_t> livres;
+    if (autres == nullptr) {
+        for (const BitmapCompresse* ensemble : ensembles) livres.push_back(ensemble->nombre);
+    } else {
+        livres = compterCommunsPlusieurs(*autres, ensembles);
+    }
+
+    std::vector<CompteFacette> comptes;
+    for (std::size_t i = 0; i < valeurs.size(); i++) {
+        if (livres[i] > 0) comptes.push_back({valeurs[i], livres[i]});
+    }
+    if (facette != FACETTE_DECENNIE) {
+        std::sort(comptes.begin(), comptes.end(), [](const CompteFacette& a, const CompteFacette& b) {
+            return a.livres != b.livres ? a.livres > b.livres : a.valeur < b.valeur;
+        });
+    }
+    return comptes;
+}
+
+std::uint32_t compterSelection(const IndexFacettes& index, const SelectionFacettes& selection) {
+    BitmapCompresse stockage;
+    const BitmapCompresse* livres = croiserChoix(index, selection, NB_FACETTES, stockage);
+    return livres == nullptr ? index.nombreLivres : livres->nombre;
+}
+
+std::vector<std::uint32_t> livresSelection(const IndexFacettes& index, const SelectionFacettes& selection) {
+    BitmapCompresse stockage;
+    const BitmapCompresse* livres = croiserChoix(index, selection, NB_FACETTES, stockage);
+    if (livres != nullptr) return positionsBitmap(*livres);
+
+    std::vector<std::uint32_t> tous(index.nombreLivres);
+    std::iota(tous.begin(), tous.end(), 0u);
+    return tous;
+}
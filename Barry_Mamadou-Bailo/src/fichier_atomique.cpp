@@ -0,0 +1,217 @@
+/**
+ * @file fichier_atomique.cpp
+ * @brief Fichier temporaire + fsync + renommage, et somme de contrôle (voir fichier_atomique.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm>  // Pour std::min
+#include <cstring>    // Pour std::memcpy
+#include <filesystem> // Pour le renommage et le dossier parent
+#include <vector>
+#include "fichier_atomique.hpp"
+
+#ifndef _WIN32
+    #include <fcntl.h>   // open()
+    #include <unistd.h>  // fsync() / close()
+#endif
+
+namespace fs = std::filesystem;
+
+// --- SOMME DE CONTRÔLE (xxHash64, graine 0) ---
+// Les données sont lues par mots de 8 octets dans l'ordre natif (little-endian sur x86/ARM),
+// comme le format binaire du catalogue.
+
+static const std::uint64_t PREMIER1 = 11400714785074694791ULL;
+static const std::uint64_t PREMIER2 = 14029467366897019727ULL;
+static const std::uint64_t PREMIER3 = 1609587929392839161ULL;
+static const std::uint64_t PREMIER4 = 9650029242287828579ULL;
+static const std::uint64_t PREMIER5 = 2870177450012600261ULL;
+
+static inline std::uint64_t rotation(std::uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline std::uint64_t lireMot64(const unsigned char* p) {
+    std::uint64_t mot;
+    std::memcpy(&mot, p, sizeof(mot)); // memcpy : pas de souci d'alignement
+    return mot;
+}
+
+static inline std::uint32_t lireMot32(const unsigned char* p) {
+    std::uint32_t mot;
+    std::memcpy(&mot, p, sizeof(mot));
+    return mot;
+}
+
+static inline std::uint64_t tour(std::uint64_t acc, std::uint64_t mot) {
+    acc += mot * PREMIER2;
+    acc = rotation(acc, 31);
+    return acc * PREMIER1;
+}
+
+static inline std::uint64_t fusionner(std::uint64_t h, std::uint64_t acc) {
+    h ^= tour(0, acc);
+    return h * PREMIER1 + PREMIER4;
+}
+
+// Traite un bloc de 32 octets : les 4 accumulateurs sont indépendants, le processeur
+// peut donc faire avancer les 4 calculs en même temps.
+static inline void traiterBloc(std::uint64_t* acc, const unsigned char* p) {
+    acc[0] = tour(acc[0], lireMot64(p));
+    acc[1] = tour(acc[1], lireMot64(p + 8));
+    acc[2] = tour(acc[2], lireMot64(p + 16));
+    acc[3] = tour(acc[3], lireMot64(p + 24));
+}
+
+void initialiserSomme(SommeControle& s) {
+    s.accumulateurs[0] = PREMIER1 + PREMIER2;
+    s.accumulateurs[1] = PREMIER2;
+    s.accumulateurs[2] = 0;
+    s.accumulateurs[3] = 0 - PREMIER1;
+    s.total = 0;
+    s.tailleReste = 0;
+}
+
+void ajouterSomme(SommeControle& s, const char* donnees, std::size_t taille) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(donnees);
+    const unsigned char* fin = p + taille;
+    s.total += taille;
+
+    // 1. On complète d'abord le bloc commencé au morceau précédent
+    if (s.tailleReste > 0) {
+        std::size_t manque = std::min<std::size_t>(32 - s.tailleReste, taille);
+        std::memcpy(s.reste + s.tailleReste, p, manque);
+        s.tailleReste += manque;
+        p += manque;
+        if (s.tailleReste < 32) return;
+        traiterBloc(s.accumulateurs, s.reste);
+        s.tailleReste = 0;
+    }
+
+    // 2. Les blocs complets, directement depuis les données
+    while (fin - p >= 32) {
+        traiterBloc(s.accumulateurs, p);
+        p += 32;
+    }
+
+    // 3. Le reste attend le prochain morceau
+    s.tailleReste = static_cast<std::size_t>(fin - p);
+    std::memcpy(s.reste, p, s.tailleReste);
+}
+
+std::uint64_t valeurSomme(const SommeControle& s) {
+    const std::uint64_t* acc = s.accumulateurs;
+    std::uint64_t h;
+    if (s.total >= 32) {
+        h = rotation(acc[0], 1) + rotation(acc[1], 7) + rotation(acc[2], 12) + rotation(acc[3], 18);
+        for (int i = 0; i < 4; i++) h = fusionner(h, acc[i]);
+    } else {
+        h = PREMIER5;
+    }
+    h += s.total;
+
+    // Les derniers octets (moins de 32) : par 8, puis par 4, puis un par un
+    const unsigned char* p = s.reste;
+    const unsigned char* fin = s.reste + s.tailleReste;
+    for (; fin - p >= 8; p += 8) {
+        h ^= tour(0, lireMot64(p));
+        h = rotation(h, 27) * PREMIER1 + PREMIER4;
+    }
+    if (fin - p >= 4) {
+        h ^= std::uint64_t(lireMot32(p)) * PREMIER1;
+        h = rotation(h, 23) * PREMIER2 + PREMIER3;
+        p += 4;
+    }
+    for (; p < fin; p++) {
+        h ^= (*p) * PREMIER5;
+        h = rotation(h, 11) * PREMIER1;
+    }
+
+    // Mélange final : chaque bit d'entrée influence tous les bits du résultat
+    h ^= h >> 33;
+    h *= PREMIER2;
+    h ^= h >> 29;
+    h *= PREMIER3;
+    h ^= h >> 32;
+    return h;
+}
+
+bool sommeFichier(const std::string& chemin, std::uint64_t taille, std::uint64_t& somme) {
+    std::ifstream fichier(chemin, std::ios::binary);
+    if (!fichier) return false;
+
+    SommeControle s;
+    initialiserSomme(s);
+    std::vector<char> bloc(TAILLE_TAMPON_SORTIE);
+    while (taille > 0) {
+        std::size_t aLire = static_cast<std::size_t>(std::min<std::uint64_t>(taille, bloc.size()));
+        if (!fichier.read(bloc.data(), static_cast<std::streamsize>(aLire))) return false;
+        ajouterSomme(s, bloc.data(), aLire);
+        taille -= aLire;
+    }
+    somme = valeurSomme(s);
+    return true;
+}
+
+// --- ÉCRITURE ATOMIQUE ---
+
+bool synchroniserFichier(const std::string& chemin) {
+#ifndef _WIN32
+    // fsync s'applique au fichier et pas au descripteur : on peut le rouvrir après fermeture
+    int fd = open(chemin.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    bool reussi = (fsync(fd) == 0);
+    close(fd);
+    return reussi;
+#else
+    (void)chemin;
+    return true;
+#endif
+}
+
+bool ouvrirFichierAtomique(FichierAtomique& f, const std::string& cible) {
+    f.cible = cible;
+    f.temporaire = cible + ".tmp";
+    f.flux.open(f.temporaire, std::ios::binary | std::ios::trunc);
+    if (!f.flux) return false;
+    ouvrirTamponSortie(f.tampon, f.flux);
+    initialiserSomme(f.somme);
+    f.tampon.somme = &f.somme;
+    return true;
+}
+
+void abandonnerFichierAtomique(FichierAtomique& f) {
+    if (f.flux.is_open()) f.flux.close();
+    std::error_code erreur;
+    fs::remove(f.temporaire, erreur);
+}
+
+bool validerFichierAtomique(FichierAtomique& f) {
+    viderTamponSortie(f.tampon);
+    f.flux.close();
+    // Un disque plein est détecté ici (l'écriture ou la fermeture a échoué)
+    if (f.flux.fail() || !synchroniserFichier(f.temporaire)) {
+        abandonnerFichierAtomique(f);
+        return false;
+    }
+
+    std::error_code erreur;
+    fs::rename(f.temporaire, f.cible, erreur);
+    if (erreur) {
+        abandonnerFichierAtomique(f);
+        return false;
+    }
+
+    // Le renommage est une modification du dossier : on le force aussi sur le disque
+    fs::path dossier = fs::path(f.cible).parent_path();
+    synchroniserFichier(dossier.empty() ? "." : dossier.string());
+    return true;
+}
+
+bool ecrireFichierAtomique(const std::string& cible, const std::string& contenu) {
+    FichierAtomique f;
+    if (!ouvrirFichierAtomique(f, cible)) return false;
+    ecrire(f.tampon, contenu);
+    return validerFichierAtomique(f);
+}
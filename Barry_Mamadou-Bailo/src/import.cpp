@@ -0,0 +1,210 @@
+/**
+ * @file import.cpp
+ * @brief Chaîne d'import CSV : lecteur -> ouvriers -> fusion ordonnée (voir import.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "import.hpp"
+#include "csv.hpp"
+
+bool remplirLivre(Book& b, const std::vector<std::string_view>& champs) {
+    if (champs.size() < 6) return false;
+    b.isbn.assign(champs[0]);
+    b.title.assign(champs[1]);
+    b.language.assign(champs[2]);
+    b.authors.assign(champs[3]);
+    b.date.assign(champs[4]);
+    b.genre.assign(champs[5]);
+    // La description est optionnelle, mais si elle est là, on la prend
+    if (champs.size() > 6) b.description.assign(champs[6]);
+    else b.description.clear();
+    return true;
+}
+
+bool remplirLivre(LivreVue& b, const std::vector<std::string_view>& champs) {
+    if (champs.size() < 6) return false;
+    b.isbn = champs[0];
+    b.title = champs[1];
+    b.language = champs[2];
+    b.authors = champs[3];
+    b.date = champs[4];
+    b.genre = champs[5];
+    b.description = (champs.size() > 6) ? champs[6] : std::string_view();
+    return true;
+}
+
+int nombreThreadsImport(int demande) {
+    if (demande > 0) return demande;
+    // hardware_concurrency() peut retourner 0 si le système ne sait pas répondre
+    unsigned int coeurs = std::thread::hardware_concurrency();
+    return coeurs > 0 ? static_cast<int>(coeurs) : 1;
+}
+
+// Ajoute un livre s'il n'existe pas déjà (même règle que l'import séquentiel)
+static int fusionnerLivre(Library& lib, const LivreVue& b) {
+    if (isbnExiste(lib, b.isbn)) return 0;
+    ajouterLivre(lib, b);
+    return 1;
+}
+
+// Version séquentielle : un seul lecteur CSV, aucun thread
+static int importerCSVSequentiel(Library& lib, std::istream& fichier, RapportImport& rapport) {
+    LecteurCSV lecteur;
+    ouvrirLecteurCSV(lecteur, fichier, ';');
+    std::vector<std::string_view> champs;
+    lireEnregistrement(lecteur, champs); // On ignore la ligne d'en-tête (Titres des colonnes)
+
+    int compteur = 0;
+    LivreVue b;
+    while (lireEnregistrement(lecteur, champs)) {
+        rapport.lignes++;
+        if (remplirLivre(b, champs)) compteur += fusionnerLivre(lib, b);
+    }
+    return compteur;
+}
+
+// Un morceau du fichier qui ne contient que des enregistrements complets
+struct BlocImport {
+    std::string donnees;         // Texte brut du bloc (modifié sur place par le découpage)
+    std::vector<LivreVue> livres; // Livres valides, dans l'ordre des lignes (vues sur 'donnees')
+    long lignes = 0;             // Enregistrements lus dans le bloc (valides ou non)
+    bool analyse = false;        // Vrai quand un ouvrier a fini de le traiter
+};
+
+// État partagé entre les trois étapes (toujours protégé par 'verrou')
+struct FileImport {
+    std::mutex verrou;
+    std::condition_variable changement;                // Réveille les threads à chaque changement d'état
+    std::deque<std::shared_ptr<BlocImport>> aAnalyser; // Blocs qui attendent un ouvrier
+    std::deque<std::shared_ptr<BlocImport>> enOrdre;   // Blocs pas encore fusionnés, dans l'ordre du fichier
+    std::size_t maxEnVol = 1;
+    bool lectureFinie = false;
+};
+
+// Étape 1 : découpe le fichier en blocs d'enregistrements complets
+static void threadLecteur(FileImport& file, std::istream& fichier) {
+    std::string reste;          // Début d'enregistrement coupé à la fin du bloc précédent
+    bool enTete = true;         // La première ligne (titres des colonnes) est ignorée
+    bool finDeFlux = false;
+
+    while (!finDeFlux) {
+        auto bloc = std::make_shared<BlocImport>();
+        bloc->donnees = std::move(reste);
+        reste.clear();
+
+        // On complète avec la suite du fichier jusqu'à avoir au moins un enregistrement complet
+        std::size_t coupe = 0;
+        while (coupe == 0 && !finDeFlux) {
+            std::size_t avant = bloc->donnees.size();
+            bloc->donnees.resize(avant + TAILLE_BLOC_IMPORT);
+            fichier.read(&bloc->donnees[avant], TAILLE_BLOC_IMPORT);
+            std::size_t lus = static_cast<std::size_t>(fichier.gcount());
+            bloc->donnees.resize(avant + lus);
+            finDeFlux = (lus == 0 || !fichier);
+
+            const char* debut = bloc->donnees.data();
+            coupe = finDeFlux ? bloc->donnees.size()
+                              : derniereFinEnregistrement(debut, debut + bloc->donnees.size(), ';');
+        }
+        reste.assign(bloc->donnees, coupe, std::string::npos);
+        bloc->donnees.resize(coupe);
+
+        if (enTete) {
+            const char* debut = bloc->donnees.data();
+            const char* fin = trouverFinEnregistrement(debut, debut + bloc->donnees.size(), ';', true);
+            std::size_t taille = fin ? static_cast<std::size_t>(fin - debut) : 0;
+            bloc->donnees.erase(0, taille < bloc->donnees.size() ? taille + 1 : taille);
+            enTete = false;
+        }
+        if (bloc->donnees.empty()) continue;
+
+        std::unique_lock<std::mutex> verrou(file.verrou);
+        file.changement.wait(verrou, [&] { return file.enOrdre.size() < file.maxEnVol; });
+        file.enOrdre.push_back(bloc);
+        file.aAnalyser.push_back(bloc);
+        file.changement.notify_all();
+    }
+
+    std::lock_guard<std::mutex> verrou(file.verrou);
+    file.lectureFinie = true;
+    file.changement.notify_all();
+}
+
+// Étape 2 : découpage et validation d'un bloc, sans toucher à la bibliothèque
+static void analyserBloc(BlocImport& bloc) {
+    std::vector<std::string_view> champs;
+    char* p = &bloc.donnees[0];
+    char* fin = p + bloc.donnees.size();
+    LivreVue b;
+    while (p < fin) {
+        const char* finEnreg = trouverFinEnregistrement(p, fin, ';', true);
+        char* finLigne = p + (finEnreg - p);
+        decouperEnregistrement(p, finLigne, ';', champs);
+        bloc.lignes++;
+        if (remplirLivre(b, champs)) bloc.livres.push_back(b);
+        p = finLigne + 1;
+    }
+}
+
+static void threadOuvrier(FileImport& file) {
+    while (true) {
+        std::shared_ptr<BlocImport> bloc;
+        {
+            std::unique_lock<std::mutex> verrou(file.verrou);
+            file.changement.wait(verrou, [&] { return !file.aAnalyser.empty() || file.lectureFinie; });
+            if (file.aAnalyser.empty()) return; // Lecture finie et plus rien à faire
+            bloc = file.aAnalyser.front();
+            file.aAnalyser.pop_front();
+        }
+
+        analyserBloc(*bloc);
+
+        std::lock_guard<std::mutex> verrou(file.verrou);
+        bloc->analyse = true;
+        file.changement.notify_all();
+    }
+}
+
+int importerCSV(Library& lib, std::istream& fichier, int nbThreads, RapportImport& rapport) {
+    nbThreads = nombreThreadsImport(nbThreads);
+    rapport.threads = nbThreads;
+    if (nbThreads == 1) return importerCSVSequentiel(lib, fichier, rapport);
+
+    FileImport file;
+    file.maxEnVol = static_cast<std::size_t>(nbThreads) * BLOCS_EN_VOL_PAR_OUVRIER;
+
+    std::thread lecteur(threadLecteur, std::ref(file), std::ref(fichier));
+    std::vector<std::thread> ouvriers;
+    for (int i = 0; i < nbThreads; i++) ouvriers.emplace_back(threadOuvrier, std::ref(file));
+
+    // Étape 3 : fusion sur le thread appelant, toujours dans l'ordre du fichier.
+    // Un bloc terminé en avance attend simplement que ceux d'avant soient fusionnés.
+    int compteur = 0;
+    while (true) {
+        std::shared_ptr<BlocImport> bloc;
+        {
+            std::unique_lock<std::mutex> verrou(file.verrou);
+            file.changement.wait(verrou, [&] {
+                return (!file.enOrdre.empty() && file.enOrdre.front()->analyse)
+                       || (file.enOrdre.empty() && file.lectureFinie);
+            });
+            if (file.enOrdre.empty()) break;
+            bloc = file.enOrdre.front();
+            file.enOrdre.pop_front();
+            file.changement.notify_all(); // Une place se libère pour le lecteur
+        }
+
+        for (const auto& b : bloc->livres) compteur += fusionnerLivre(lib, b);
+        rapport.lignes += bloc->lignes;
+    }
+
+    lecteur.join();
+    for (auto& t : ouvriers) t.join();
+    return compteur;
+}
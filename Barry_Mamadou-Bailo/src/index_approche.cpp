@@ -0,0 +1,222 @@
+/**
+ * @file index_approche.cpp
+ * @brief Index des trigrammes et recherche approchée (voir index_approche.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::sort, std::min
+#include <sstream>
+#include "index_approche.hpp"
+#include "utils.hpp" // Pour normaliserTexte
+
+// Les mots plus longs ne sont comparés qu'exactement (distanceEdition travaille dans un tableau fixe)
+const std::size_t LONGUEUR_MOT_MAX = 63;
+
+// Trigramme commençant à p[i] dans le mot entouré de deux octets 0 (le début et la fin du mot)
+static std::uint32_t trigramme(std::string_view mot, std::size_t i) {
+    auto octet = [&](std::size_t j) -> std::uint32_t {
+        return (j == 0 || j > mot.size()) ? 0 : static_cast<unsigned char>(mot[j - 1]);
+    };
+    return (octet(i) << 16) | (octet(i + 1) << 8) | octet(i + 2);
+}
+
+// Les trigrammes d'un mot de n octets : n (ex: "go" -> "^go", "go$")
+static std::vector<std::uint32_t> trigrammesDuMot(std::string_view mot) {
+    std::vector<std::uint32_t> resultat;
+    for (std::size_t i = 0; i < mot.size(); i++) resultat.push_back(trigramme(mot, i));
+    std::sort(resultat.begin(), resultat.end());
+    resultat.erase(std::unique(resultat.begin(), resultat.end()), resultat.end());
+    return resultat;
+}
+
+// Lettres d'un mot, un bit par octet (deux octets peuvent tomber sur le même bit : le
+// filtre n'écarte alors que moins de mots, jamais un mot proche)
+static std::uint32_t masqueLettres(std::string_view mot) {
+    std::uint32_t masque = 0;
+    for (unsigned char c : mot) masque |= std::uint32_t{1} << (c & 31);
+    return masque;
+}
+
+// Numéro d'un mot, ajouté au vocabulaire (et à ses trigrammes) s'il est nouveau
+static std::uint32_t numeroDuMot(IndexApproche& index, const std::string& mot) {
+    auto trouve = index.numeros.find(mot);
+    if (trouve != index.numeros.end()) return trouve->second;
+
+    std::uint32_t numero = static_cast<std::uint32_t>(index.mots.size());
+    index.numeros.emplace(mot, numero);
+    index.mots.push_back(mot);
+    index.livres.emplace_back();
+    index.lettres.push_back(masqueLettres(mot));
+    for (std::uint32_t t : trigrammesDuMot(mot)) index.trigrammes[t].push_back(numero);
+    return numero;
+}
+
+void indexerApproche(IndexApproche& index, std::uint32_t position, const LivreVue& livre) {
+    auto indexerChamp = [&](std::string_view champ, std::uint32_t poids) {
+        std::istringstream flux(normaliserTexte(champ));
+        std::string mot;
+        while (flux >> mot) {
+            std::vector<Occurrence>& liste = index.livres[numeroDuMot(index, mot)];
+            // Un mot déjà vu dans ce livre garde le poids de son meilleur champ
+            if (!liste.empty() && liste.back().livre == position) liste.back().poids = std::max(liste.back().poids, poids);
+            else liste.push_back({position, poids});
+        }
+    };
+    indexerChamp(livre.title, POIDS_TITRE);
+    indexerChamp(livre.authors, POIDS_AUTEURS);
+}
+
+void viderIndexApproche(IndexApproche& index) {
+    index = IndexApproche();
+}
+
+void construireIndexApproche(IndexApproche& index, const CatalogueCompact& livres) {
+    if (index.construit) return;
+    viderIndexApproche(index);
+    for (std::size_t i = 0; i < livres.size(); i++) {
+        indexerApproche(index, static_cast<std::uint32_t>(i), livres[i]);
+    }
+    index.construit = true;
+}
+
+int fautesTolerees(std::size_t longueur) {
+    if (longueur <= 3) return 0;
+    if (longueur <= 7) return 1;
+    return 2;
+}
+
+int distanceEdition(std::string_view a, std::string_view b, int maximum) {
+    if (a == b) return 0;
+    const int ecart = static_cast<int>(a.size() > b.size() ? a.size() - b.size() : b.size() - a.size());
+    if (ecart > maximum || a.size() > LONGUEUR_MOT_MAX || b.size() > LONGUEUR_MOT_MAX) return maximum + 1;
+
+    // Trois lignes du tableau classique : courante[j] = distance entre a[0..i) et b[0..j)
+    // (la ligne d'avant-avant sert aux deux lettres voisines inversées). Une case loin de la
+    // diagonale (|i - j| > maximum) dépasse forcément 'maximum' : seule la bande autour de la
+    // diagonale est calculée, les cases hors bande valent "trop loin".
+    const int tropLoin = maximum + 1;
+    const int m = static_cast<int>(b.size());
+    int lignes[3][LONGUEUR_MOT_MAX + 1];
+    for (int* ligne : lignes) std::fill(ligne, ligne + m + 1, tropLoin);
+    int* avantAvant = lignes[0];
+    int* precedente = lignes[1];
+    int* courante = lignes[2];
+    for (int j = 0; j <= std::min(m, maximum); j++) precedente[j] = j;
+
+    for (int i = 1; i <= static_cast<int>(a.size()); i++) {
+        const int debut = std::max(1, i - maximum), fin = std::min(m, i + maximum);
+        courante[debut - 1] = (debut == 1 && i <= maximum) ? i : tropLoin;
+        int minimumLigne = courante[debut - 1];
+        for (int j = debut; j <= fin; j++) {
+            int remplacement = precedente[j - 1] + (a[i - 1] != b[j - 1] ? 1 : 0);
+            int valeur = std::min(std::min(precedente[j], courante[j - 1]) + 1, remplacement);
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+                valeur = std::min(valeur, avantAvant[j - 2] + 1); // "ab" tapé "ba"
+            }
+            courante[j] = valeur;
+            minimumLigne = std::min(minimumLigne, valeur);
+        }
+        if (fin < m) courante[fin + 1] = tropLoin; // La ligne réutilisée peut garder une ancienne valeur
+        // La distance ne peut plus descendre sous le minimum de la ligne : inutile de continuer
+        if (minimumLigne > maximum) return tropLoin;
+        int* libre = avantAvant;
+        avantAvant = precedente;
+        precedente = courante;
+        courante = libre;
+    }
+    return std::min(precedente[m], tropLoin);
+}
+
+// Résultat intermédiaire : (livre, score)
+struct LivreApproche {
+    std::uint32_t livre;
+    double score;
+};
+
+// Livres d'UN mot de la requête (positions croissantes, sans doublon), avec leur score
+static std::vector<LivreApproche> livresPourMot(const IndexApproche& index, const std::string& mot) {
+    std::vector<LivreApproche> resultat;
+    // Un mot trop long n'est cherché qu'exactement (comme dans distanceEdition)
+    const int fautes = mot.size() > LONGUEUR_MOT_MAX ? 0 : fautesTolerees(mot.size());
+
+    // Mots retenus : (numéro, distance)
+    std::vector<std::pair<std::uint32_t, int>> retenus;
+    if (fautes == 0) {
+        auto trouve = index.numeros.find(mot);
+        if (trouve != index.numeros.end()) retenus.push_back({trouve->second, 0});
+    } else {
+        // 1. Nombre de trigrammes partagés avec chaque mot du vocabulaire. Une faute change au
+        //    plus 4 trigrammes (3, ou 4 pour deux lettres inversées) : un mot n'est candidat
+        //    qu'à partir de 'seuil' trigrammes partagés, et n'est examiné qu'une fois (en l'atteignant)
+        std::vector<std::uint32_t> trigrammes = trigrammesDuMot(mot);
+        const int seuil = std::max(1, static_cast<int>(trigrammes.size()) - 4 * fautes);
+        const std::uint32_t lettres = masqueLettres(mot);
+        std::vector<std::uint8_t> partages(index.mots.size(), 0);
+        for (std::uint32_t t : trigrammes) {
+            auto liste = index.trigrammes.find(t);
+            if (liste == index.trigrammes.end()) continue;
+            for (std::uint32_t numero : liste->second) {
+                if (++partages[numero] != seuil) continue;
+
+                // 2. Filtre rapide avant la distance (sans lire le mot lui-même) : chaque faute
+                //    n'ajoute ou n'enlève qu'une lettre, de chaque côté
+                const std::uint32_t autres = index.lettres[numero];
+                if (__builtin_popcount(lettres & ~autres) > fautes || __builtin_popcount(autres & ~lettres) > fautes) continue;
+
+                // 3. Distance d'édition, seulement pour les candidats restants
+                int distance = distanceEdition(mot, index.mots[numero], fautes);
+                if (distance <= fautes) retenus.push_back({numero, distance});
+            }
+        }
+    }
+
+    // 4. Livres des mots retenus : un mot exact vaut son poids, une faute le divise par 2, deux par 3
+    for (const auto& r : retenus) {
+        double facteur = 1.0 / (1 + r.second);
+        for (const Occurrence& occ : index.livres[r.first]) resultat.push_back({occ.livre, occ.poids * facteur});
+    }
+    if (retenus.size() > 1) {
+        // Un livre trouvé par plusieurs mots proches garde le meilleur score
+        std::sort(resultat.begin(), resultat.end(), [](const LivreApproche& a, const LivreApproche& b) {
+            return a.livre != b.livre ? a.livre < b.livre : a.score > b.score;
+        });
+        resultat.erase(std::unique(resultat.begin(), resultat.end(),
+                                   [](const LivreApproche& a, const LivreApproche& b) { return a.livre == b.livre; }),
+                       resultat.end());
+    }
+    return resultat;
+}
+
+std::vector<std::uint32_t> rechercherApproche(const IndexApproche& index, const std::string& requete) {
+    std::vector<std::string> mots;
+    std::istringstream flux(normaliserTexte(requete));
+    std::string mot;
+    while (flux >> mot) mots.push_back(mot);
+    if (mots.empty()) return {};
+
+    // ET : chaque mot de la requête réduit la liste (les scores s'additionnent)
+    std::vector<LivreApproche> candidats = livresPourMot(index, mots[0]);
+    for (std::size_t m = 1; m < mots.size() && !candidats.empty(); m++) {
+        std::vector<LivreApproche> autres = livresPourMot(index, mots[m]);
+        std::size_t ecriture = 0, j = 0;
+        for (std::size_t i = 0; i < candidats.size(); i++) {
+            while (j < autres.size() && autres[j].livre < candidats[i].livre) j++;
+            if (j < autres.size() && autres[j].livre == candidats[i].livre) {
+                candidats[ecriture++] = {candidats[i].livre, candidats[i].score + autres[j].score};
+            }
+        }
+        candidats.resize(ecriture);
+    }
+
+    // Classement : meilleur score d'abord, puis ordre du catalogue en cas d'égalité
+    std::sort(candidats.begin(), candidats.end(), [](const LivreApproche& a, const LivreApproche& b) {
+        if (a.score != b.score) return a.score > b.score;
+        return a.livre < b.livre;
+    });
+
+    std::vector<std::uint32_t> positions;
+    positions.reserve(candidats.size());
+    for (const auto& c : candidats) positions.push_back(c.livre);
+    return positions;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file index_dates.cpp
+ * @brief Construction et interrogation de l'index des dates (voir index_dates.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::sort, std::inplace_merge, std::lower_bound
+#include "index_dates.hpp"
+
+// Ordre de l'index : par date, puis par position (deux livres de même date gardent l'ordre du catalogue)
+static bool avant(const EntreeDate& a, const EntreeDate& b) {
+    return a.date != b.date ? a.date < b.date : a.livre < b.livre;
+}
+
+void indexerDate(IndexDates& index, std::uint32_t position, std::uint32_t date) {
+    if (index.construit) index.enAttente.push_back({date, position});
+}
+
+void viderIndexDates(IndexDates& index) {
+    index = IndexDates();
+}
+
+void preparerIndexDates(IndexDates& index, const CatalogueCompact& livres) {
+    if (!index.construit) {
+        index.tries.clear();
+        index.tries.reserve(livres.size());
+        for (std::size_t i = 0; i < livres.size(); i++) {
+            index.tries.push_back({livres.livres[i].date, static_cast<std::uint32_t>(i)});
+        }
+        std::sort(index.tries.begin(), index.tries.end(), avant);
+        index.enAttente.clear();
+        index.construit = true;
+        return;
+    }
+    if (index.enAttente.empty()) return;
+
+    // Les nouveaux livres sont triés entre eux, puis fusionnés avec l'index déjà trié (temps linéaire)
+    std::sort(index.enAttente.begin(), index.enAttente.end(), avant);
+    std::size_t anciens = index.tries.size();
+    index.tries.insert(index.tries.end(), index.enAttente.begin(), index.enAttente.end());
+    std::inplace_merge(index.tries.begin(), index.tries.begin() + static_cast<std::ptrdiff_t>(anciens),
+                       index.tries.end(), avant);
+    index.enAttente.clear();
+}
+
+TrancheDates chercherEntreDates(const IndexDates& index, std::uint32_t dateMin, std::uint32_t dateMax) {
+    TrancheDates tranche;
+    if (dateMin == 0) dateMin = 1; // La date 0 marque les dates invalides : jamais dans un intervalle
+    if (dateMin > dateMax) return tranche;
+
+    // Deux recherches dichotomiques : premier livre >= dateMin, premier livre > dateMax
+    const EntreeDate* debut = index.tries.data();
+    const EntreeDate* fin = debut + index.tries.size();
+    tranche.debut = std::lower_bound(debut, fin, dateMin,
+        [](const EntreeDate& e, std::uint32_t date) { return e.date < date; });
+    tranche.fin = std::upper_bound(tranche.debut, fin, dateMax,
+        [](std::uint32_t date, const EntreeDate& e) { return date < e.date; });
+    return tranche;
+}
+
+TrancheDates livresDates(const IndexDates& index) {
+    return chercherEntreDates(index, 1, 0xFFFFFFFF);
+}
@@ -0,0 +1,281 @@
+/**
+ * @file index_editeurs.cpp
+ * @brief Découpage des ISBN et index trié des éditeurs (voir index_editeurs.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::sort, std::inplace_merge, std::lower_bound
+#include <cctype>    // Pour std::isdigit
+#include "index_editeurs.hpp"
+#include "recherche_texte.hpp" // Recherche de "-CODE-" dans les ISBN non découpés
+
+// --- TABLE DES TRANCHES (ISBN SANS TIRETS) ---
+
+// Les 7 chiffres qui suivent le groupe (complétés par des zéros) tombent dans une tranche,
+// qui donne le nombre de chiffres de l'éditeur. Ex: groupe 2, "0703682" -> éditeur "07".
+struct PlageEditeurs {
+    std::uint32_t debut, fin;
+    int chiffres;
+};
+
+struct GroupeIsbn {
+    bool prefixe979;
+    std::string_view groupe;
+    std::vector<PlageEditeurs> plages;
+};
+
+// Extrait de la table de l'agence internationale de l'ISBN (isbn-international.org,
+// "RangeMessage") pour les groupes les plus courants. Un groupe absent : ISBN non découpé.
+static const std::vector<GroupeIsbn> GROUPES = {
+    {false, "0", {{0, 1999999, 2}, {2000000, 2279999, 3}, {2280000, 2289999, 4}, {2290000, 6479999, 3},
+                  {6480000, 6489999, 7}, {6490000, 6999999, 3}, {7000000, 8499999, 4}, {8500000, 8999999, 5},
+                  {9000000, 9499999, 6}, {9500000, 9999999, 7}}},
+    {false, "1", {{0, 999999, 2}, {1000000, 3999999, 3}, {4000000, 5499999, 4}, {5500000, 8697999, 5},
+                  {8698000, 9989999, 6}, {9990000, 9999999, 7}}},
+    {false, "2", {{0, 1999999, 2}, {2000000, 3499999, 3}, {3500000, 3999999, 5}, {4000000, 6999999, 3},
+                  {7000000, 8399999, 4}, {8400000, 8999999, 5}, {9000000, 9499999, 6}, {9500000, 9999999, 7}}},
+    {false, "3", {{0, 299999, 2}, {300000, 339999, 3}, {340000, 369999, 4}, {370000, 399999, 5},
+                  {400000, 1999999, 2}, {2000000, 6999999, 3}, {7000000, 8499999, 4}, {8500000, 8999999, 5},
+                  {9000000, 9499999, 6}, {9500000, 9539999, 7}, {9540000, 9699999, 5}, {9700000, 9849999, 7},
+                  {9850000, 9999999, 5}}},
+    {false, "4", {{0, 1999999, 2}, {2000000, 6999999, 3}, {7000000, 8499999, 4}, {8500000, 8999999, 5},
+                  {9000000, 9499999, 6}, {9500000, 9999999, 7}}},
+    {false, "7", {{0, 999999, 2}, {1000000, 4999999, 3}, {5000000, 7999999, 4}, {8000000, 8999999, 5},
+                  {9000000, 9999999, 6}}},
+    {false, "84", {{0, 1399999, 2}, {1400000, 1499999, 3}, {1500000, 1999999, 5}, {2000000, 6999999, 3},
+                   {7000000, 8499999, 4}, {8500000, 8999999, 5}, {9000000, 9199999, 4}, {9200000, 9239999, 6},
+                   {9240000, 9299999, 5}, {9300000, 9499999, 6}, {9500000, 9699999, 5}, {9700000, 9999999, 4}}},
+    {true, "10", {{0, 1999999, 2}, {2000000, 6999999, 3}, {7000000, 8999999, 4}, {9000000, 9759999, 5},
+                  {9760000, 9999999, 6}}},
+};
+
+// --- DÉCOUPAGE ---
+
+static bool queDesChiffres(std::string_view texte) {
+    if (texte.empty()) return false;
+    for (char c : texte) {
+        if (!std::isdigit(static_cast<unsigned char>(c))) return false;
+    }
+    return true;
+}
+
+// Valeur d'une suite de chiffres (au plus 9, déjà vérifiés)
+static std::uint32_t valeur(std::string_view chiffres) {
+    std::uint32_t v = 0;
+    for (char c : chiffres) v = v * 10 + static_cast<std::uint32_t>(c - '0');
+    return v;
+}
+
+// Sans tirets : 'corps' = groupe + éditeur + publication (9 chiffres, sans préfixe ni clé)
+static bool decouperSansTirets(bool prefixe979, std::string_view corps, StructureIsbn& structure) {
+    for (const GroupeIsbn& g : GROUPES) {
+        if (g.prefixe979 != prefixe979 || corps.substr(0, g.groupe.size()) != g.groupe) continue;
+
+        std::string_view reste = corps.substr(g.groupe.size());
+        std::uint32_t fenetre = 0;
+        for (std::size_t i = 0; i < 7; i++) fenetre = fenetre * 10 + (i < reste.size() ? static_cast<std::uint32_t>(reste[i] - '0') : 0);
+
+        for (const PlageEditeurs& p : g.plages) {
+            if (fenetre < p.debut || fenetre > p.fin) continue;
+            // Il doit rester au moins un chiffre pour la publication
+            if (static_cast<std::size_t>(p.chiffres) >= reste.size()) return false;
+            structure.prefixe979 = prefixe979;
+            structure.groupe = valeur(g.groupe);
+            structure.chiffresGroupe = static_cast<int>(g.groupe.size());
+            structure.editeur = valeur(reste.substr(0, static_cast<std::size_t>(p.chiffres)));
+            structure.chiffresEditeur = p.chiffres;
+            return true;
+        }
+        return false; // Tranche pas encore attribuée
+    }
+    return false;
+}
+
+bool decouperIsbn(std::string_view isbn, StructureIsbn& structure) {
+    // Espaces et retour chariot autour de l'ISBN
+    while (!isbn.empty() && (isbn.front() == ' ' || isbn.front() == '\r')) isbn.remove_prefix(1);
+    while (!isbn.empty() && (isbn.back() == ' ' || isbn.back() == '\r')) isbn.remove_suffix(1);
+
+    // Parties séparées par des tirets (ou des espaces)
+    std::string_view parties[5];
+    std::size_t nombre = 0;
+    std::size_t debut = 0;
+    while (true) {
+        std::size_t fin = isbn.find_first_of("- ", debut);
+        if (nombre == 5) return false;
+        parties[nombre++] = isbn.substr(debut, fin == std::string_view::npos ? std::string_view::npos : fin - debut);
+        if (fin == std::string_view::npos) break;
+        debut = fin + 1;
+    }
+
+    if (nombre == 1) {
+        std::string_view s = parties[0];
+        if (s.size() == 13 && queDesChiffres(s) && (s.substr(0, 3) == "978" || s.substr(0, 3) == "979")) {
+            return decouperSansTirets(s[2] == '9', s.substr(3, 9), structure);
+        }
+        // ISBN-10 : 9 chiffres et une clé (chiffre ou X), toujours en 978
+        if (s.size() == 10 && queDesChiffres(s.substr(0, 9)) && (std::isdigit(static_cast<unsigned char>(s[9])) || s[9] == 'X' || s[9] == 'x')) {
+            return decouperSansTirets(false, s.substr(0, 9), structure);
+        }
+        return false;
+    }
+
+    // Avec tirets : [préfixe-]groupe-éditeur-publication-clé
+    bool isbn13 = (nombre == 5);
+    if (nombre != 4 && nombre != 5) return false;
+    std::string_view cle = parties[nombre - 1];
+    if (cle.size() != 1 || !(std::isdigit(static_cast<unsigned char>(cle[0])) || (!isbn13 && (cle[0] == 'X' || cle[0] == 'x')))) return false;
+    std::size_t chiffres = 1;
+    for (std::size_t i = 0; i + 1 < nombre; i++) {
+        if (!queDesChiffres(parties[i])) return false;
+        chiffres += parties[i].size();
+    }
+    if (chiffres != (isbn13 ? 13u : 10u)) return false;
+    if (isbn13 && parties[0] != "978" && parties[0] != "979") return false;
+
+    std::string_view groupe = parties[isbn13 ? 1 : 0];
+    std::string_view editeur = parties[isbn13 ? 2 : 1];
+    if (groupe.size() > 5 || editeur.size() > 7) return false;
+    structure.prefixe979 = isbn13 && parties[0] == "979";
+    structure.groupe = valeur(groupe);
+    structure.chiffresGroupe = static_cast<int>(groupe.size());
+    structure.editeur = valeur(editeur);
+    structure.chiffresEditeur = static_cast<int>(editeur.size());
+    return true;
+}
+
+// --- INDEX ---
+
+// Clé d'un éditeur : | préfixe (1 bit) | chiffres du groupe (3) | groupe (17) | chiffres de l'éditeur (3) | éditeur (27) |
+// Les 30 bits du bas désignent l'éditeur dans son groupe, ceux du dessus le groupe.
+const int BITS_EDITEUR = 30;
+
+static std::uint64_t partieEditeur(const StructureIsbn& s) {
+    return (static_cast<std::uint64_t>(s.chiffresEditeur) << 27) | s.editeur;
+}
+
+static std::uint64_t partieGroupe(bool prefixe979, std::uint32_t groupe, int chiffresGroupe) {
+    return (static_cast<std::uint64_t>(prefixe979) << 20) | (static_cast<std::uint64_t>(chiffresGroupe) << 17) | groupe;
+}
+
+static std::uint64_t cleEditeur(const StructureIsbn& s) {
+    return (partieGroupe(s.prefixe979, s.groupe, s.chiffresGroupe) << BITS_EDITEUR) | partieEditeur(s);
+}
+
+// Ordre de l'index : par clé, puis par position (les livres d'un éditeur gardent l'ordre du catalogue)
+static bool avant(const EntreeEditeur& a, const EntreeEditeur& b) {
+    return a.cle != b.cle ? a.cle < b.cle : a.livre < b.livre;
+}
+
+static void indexerDecoupe(IndexEditeurs& index, std::vector<EntreeEditeur>& destination, std::uint32_t position, std::string_view isbn) {
+    StructureIsbn structure;
+    if (decouperIsbn(isbn, structure)) {
+        destination.push_back({cleEditeur(structure), position});
+    } else {
+        index.nonDecoupes.push_back(position);
+    }
+}
+
+void indexerEditeur(IndexEditeurs& index, std::uint32_t position, std::string_view isbn) {
+    if (index.construit) indexerDecoupe(index, index.enAttente, position, isbn);
+}
+
+void viderIndexEditeurs(IndexEditeurs& index) {
+    index = IndexEditeurs();
+}
+
+void preparerIndexEditeurs(IndexEditeurs& index, const CatalogueCompact& livres) {
+    if (!index.construit) {
+        index.tries.clear();
+        index.nonDecoupes.clear();
+        index.tries.reserve(livres.size());
+        for (std::size_t i = 0; i < livres.size(); i++) {
+            indexerDecoupe(index, index.tries, static_cast<std::uint32_t>(i), livres[i].isbn);
+        }
+        std::sort(index.tries.begin(), index.tries.end(), avant);
+        index.enAttente.clear();
+        index.construit = true;
+        return;
+    }
+    if (index.enAttente.empty()) return;
+
+    // Les nouveaux livres sont triés entre eux, puis fusionnés avec l'index déjà trié (temps linéaire)
+    std::sort(index.enAttente.begin(), index.enAttente.end(), avant);
+    std::size_t anciens = index.tries.size();
+    index.tries.insert(index.tries.end(), index.enAttente.begin(), index.enAttente.end());
+    std::inplace_merge(index.tries.begin(), index.tries.begin() + static_cast<std::ptrdiff_t>(anciens),
+                       index.tries.end(), avant);
+    index.enAttente.clear();
+}
+
+// Ajoute les livres de clé 'cle' trouvés dans [debut, fin) par dichotomie. Retourne la fin de la tranche.
+static const EntreeEditeur* ajouterTranche(const EntreeEditeur* debut, const EntreeEditeur* fin, std::uint64_t cle,
+                                           std::vector<std::uint32_t>& resultat) {
+    const EntreeEditeur* it = std::lower_bound(debut, fin, cle,
+        [](const EntreeEditeur& e, std::uint64_t c) { return e.cle < c; });
+    for (; it != fin && it->cle == cle; ++it) resultat.push_back(it->livre);
+    return it;
+}
+
+std::vector<std::uint32_t> chercherEditeur(const IndexEditeurs& index, const CatalogueCompact& livres, std::string_view code) {
+    std::vector<std::uint32_t> resultat;
+
+    // Le code se lit comme la fin d'un début d'ISBN : [[préfixe-]groupe-]éditeur
+    std::string_view parties[3];
+    std::size_t nombre = 0;
+    bool valide = true;
+    std::size_t debut = 0;
+    while (valide) {
+        std::size_t fin = code.find('-', debut);
+        std::string_view partie = code.substr(debut, fin == std::string_view::npos ? std::string_view::npos : fin - debut);
+        while (!partie.empty() && partie.front() == ' ') partie.remove_prefix(1);
+        while (!partie.empty() && partie.back() == ' ') partie.remove_suffix(1);
+        valide = nombre < 3 && queDesChiffres(partie);
+        if (valide) parties[nombre++] = partie;
+        if (fin == std::string_view::npos) break;
+        debut = fin + 1;
+    }
+    if (valide && nombre == 3) valide = (parties[0] == "978" || parties[0] == "979");
+    if (valide && nombre >= 2) valide = parties[nombre - 2].size() <= 5;
+    if (valide) valide = parties[nombre - 1].size() <= 7;
+
+    const EntreeEditeur* tous = index.tries.data();
+    const EntreeEditeur* fin = tous + index.tries.size();
+    if (valide) {
+        StructureIsbn cherche;
+        cherche.editeur = valeur(parties[nombre - 1]);
+        cherche.chiffresEditeur = static_cast<int>(parties[nombre - 1].size());
+        const std::uint64_t editeur = partieEditeur(cherche);
+
+        if (nombre == 1) {
+            // Éditeur seul : une recherche dans chaque groupe présent (quelques dizaines au plus)
+            const EntreeEditeur* it = tous;
+            while (it != fin) {
+                const std::uint64_t groupe = it->cle >> BITS_EDITEUR;
+                it = ajouterTranche(it, fin, (groupe << BITS_EDITEUR) | editeur, resultat);
+                it = std::lower_bound(it, fin, (groupe + 1) << BITS_EDITEUR,
+                    [](const EntreeEditeur& e, std::uint64_t c) { return e.cle < c; });
+            }
+        } else {
+            std::string_view groupe = parties[nombre - 2];
+            for (bool prefixe979 : {false, true}) {
+                if (nombre == 3 && prefixe979 != (parties[0] == "979")) continue;
+                std::uint64_t cle = (partieGroupe(prefixe979, valeur(groupe), static_cast<int>(groupe.size())) << BITS_EDITEUR) | editeur;
+                ajouterTranche(tous, fin, cle, resultat);
+            }
+        }
+    }
+
+    // Les ISBN non découpés : comme avant, l'ISBN contient "-CODE-"
+    if (!code.empty() && !index.nonDecoupes.empty()) {
+        MotifRecherche motif = preparerMotif("-" + std::string(code) + "-", false);
+        for (std::uint32_t position : index.nonDecoupes) {
+            if (contientMotif(livres[position].isbn, motif)) resultat.push_back(position);
+        }
+    }
+
+    // Plusieurs tranches (groupes, ISBN non découpés) : on rend l'ordre du catalogue
+    std::sort(resultat.begin(), resultat.end());
+    return resultat;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file index_isbn.cpp
+ * @brief Recherche d'un livre par ISBN (voir index_isbn.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::lower_bound
+#include <cctype>    // Pour std::toupper
+#include "index_isbn.hpp"
+#include "index_tris.hpp" // Pour comparerIsbn
+
+std::string normaliserIsbn(std::string_view isbn) {
+    std::string cle;
+    cle.reserve(isbn.size());
+    // On ne garde que les caractères significatifs (les tirets et espaces sont décoratifs)
+    for (char c : isbn) {
+        if (c == '-' || c == ' ' || c == '\r') continue;
+        cle += std::toupper(static_cast<unsigned char>(c));
+    }
+    return cle;
+}
+
+void utiliserOrdreFichier(IndexIsbn& index, const std::uint32_t* ordre, std::uint32_t nombre) {
+    viderIndexIsbn(index);
+    index.ordreFichier = ordre;
+    index.nbFichier = nombre;
+}
+
+void indexerIsbn(IndexIsbn& index, std::uint32_t position, std::string_view isbn) {
+    // emplace ne remplace pas une clé existante : en cas de doublon, le premier livre gagne
+    if (index.construit) index.positions.emplace(normaliserIsbn(isbn), position);
+}
+
+void viderIndexIsbn(IndexIsbn& index) {
+    index = IndexIsbn();
+}
+
+long chercherIsbn(IndexIsbn& index, const CatalogueCompact& livres, std::string_view isbn) {
+    std::string cle = normaliserIsbn(isbn);
+
+    // 1. Livres du fichier : recherche dichotomique dans leur ordre par ISBN. À ISBN égal,
+    // l'ordre est celui des positions : lower_bound donne donc le premier livre.
+    if (index.nbFichier > 0) {
+        const std::uint32_t* fin = index.ordreFichier + index.nbFichier;
+        const std::uint32_t* trouve = std::lower_bound(index.ordreFichier, fin, cle,
+            [&livres](std::uint32_t position, const std::string& cherche) {
+                return comparerIsbn(livres[position].isbn, cherche) < 0;
+            });
+        if (trouve != fin && comparerIsbn(livres[*trouve].isbn, cle) == 0) return static_cast<long>(*trouve);
+    }
+
+    // 2. Les autres livres : table de hachage, construite à la première recherche
+    if (!index.construit) {
+        index.positions.reserve(livres.size() - index.nbFichier);
+        for (std::size_t i = index.nbFichier; i < livres.size(); i++) {
+            index.positions.emplace(normaliserIsbn(livres[i].isbn), static_cast<std::uint32_t>(i));
+        }
+        index.construit = true;
+    }
+    auto it = index.positions.find(cle);
+    if (it == index.positions.end()) return -1;
+    return static_cast<long>(it->second);
+}
@@ -0,0 +1,220 @@
+/**
+ * @file index_texte.cpp
+ * @brief Construction et interrogation de l'index inversé (voir index_texte.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::sort
+#include <cmath>     // Pour std::log (poids des mots rares)
+#include <sstream>
+#include "index_texte.hpp"
+#include "utils.hpp" // Pour normaliserTexte
+
+// Découpe un texte normalisé en mots (séparés par des espaces) et appelle 'action' pour chacun
+template <typename Action>
+static void pourChaqueMot(const std::string& texte, Action action) {
+    std::size_t i = 0;
+    while (i < texte.size()) {
+        while (i < texte.size() && texte[i] == ' ') i++;
+        std::size_t debut = i;
+        while (i < texte.size() && texte[i] != ' ') i++;
+        if (i > debut) action(texte.substr(debut, i - debut));
+    }
+}
+
+// Ajoute une occurrence, ou augmente le poids si le livre est déjà le dernier de la liste
+// (cas d'un mot présent dans plusieurs champs du même livre)
+static void ajouterOccurrence(IndexTexte& index, const std::string& mot, std::uint32_t position, std::uint32_t poids) {
+    std::vector<Occurrence>& liste = index.termes[mot];
+    if (!liste.empty() && liste.back().livre == position) liste.back().poids += poids;
+    else liste.push_back({position, poids});
+}
+
+void indexerTexte(IndexTexte& index, std::uint32_t position, const LivreVue& livre) {
+    auto indexerChamp = [&](std::string_view champ, std::uint32_t poids) {
+        pourChaqueMot(normaliserTexte(champ), [&](const std::string& mot) {
+            ajouterOccurrence(index, mot, position, poids);
+        });
+    };
+    indexerChamp(livre.title, POIDS_TITRE);
+    indexerChamp(livre.authors, POIDS_AUTEURS);
+    indexerChamp(livre.genre, POIDS_GENRE);
+    indexerChamp(livre.description, POIDS_DESCRIPTION);
+    index.nbLivres = position + 1;
+}
+
+void viderIndexTexte(IndexTexte& index) {
+    index.termes.clear();
+    index.construit = false;
+    index.nbLivres = 0;
+}
+
+void construireIndexTexte(IndexTexte& index, const CatalogueCompact& livres) {
+    if (index.construit) return;
+    viderIndexTexte(index);
+    for (std::size_t i = 0; i < livres.size(); i++) {
+        indexerTexte(index, static_cast<std::uint32_t>(i), livres[i]);
+    }
+    index.construit = true;
+}
+
+// Résultat intermédiaire : (livre, score)
+struct Candidat {
+    std::uint32_t livre;
+    double score;
+};
+
+// Livres correspondant à UN terme de la requête.
+// Pour un mot exact, on pointe directement sur la liste de l'index (aucune copie) ;
+// pour un préfixe, on fusionne les listes de tous les mots concernés.
+struct ListeTerme {
+    const std::vector<Occurrence>* occurrences = nullptr; // Mot exact
+    double rarete = 0;                                    // Multiplicateur du poids (mot exact)
+    std::vector<Candidat> fusion;                         // Préfixe (déjà pondéré)
+
+    std::size_t taille() const { return occurrences ? occurrences->size() : fusion.size(); }
+    std::uint32_t livre(std::size_t i) const { return occurrences ? (*occurrences)[i].livre : fusion[i].livre; }
+    double score(std::size_t i) const { return occurrences ? (*occurrences)[i].poids * rarete : fusion[i].score; }
+};
+
+// Un mot rare est plus significatif qu'un mot présent partout (principe du tf-idf)
+static double calculerRarete(const IndexTexte& index, std::size_t nbLivresAvecLeMot) {
+    return std::log(1.0 + double(index.nbLivres) / double(nbLivresAvecLeMot));
+}
+
+static ListeTerme listePourTerme(const IndexTexte& index, const std::string& terme, bool prefixe) {
+    ListeTerme liste;
+    static const std::vector<Occurrence> vide;
+
+    if (!prefixe) {
+        auto it = index.termes.find(terme);
+        liste.occurrences = (it != index.termes.end()) ? &it->second : &vide;
+        if (it != index.termes.end()) liste.rarete = calculerRarete(index, it->second.size());
+        return liste;
+    }
+
+    // Préfixe : tous les mots de l'intervalle qui commence à 'terme' dans la map triée
+    std::size_t nbMots = 0;
+    for (auto it = index.termes.lower_bound(terme);
+         it != index.termes.end() && it->first.compare(0, terme.size(), terme) == 0; ++it) {
+        double rarete = calculerRarete(index, it->second.size());
+        for (const auto& occ : it->second) liste.fusion.push_back({occ.livre, occ.poids * rarete});
+        nbMots++;
+    }
+    // Plusieurs mots peuvent viser le même livre : on trie puis on regroupe
+    if (nbMots > 1) {
+        std::sort(liste.fusion.begin(), liste.fusion.end(),
+                  [](const Candidat& a, const Candidat& b) { return a.livre < b.livre; });
+        std::size_t ecriture = 0;
+        for (std::size_t i = 0; i < liste.fusion.size(); i++) {
+            if (ecriture > 0 && liste.fusion[ecriture - 1].livre == liste.fusion[i].livre) {
+                liste.fusion[ecriture - 1].score += liste.fusion[i].score;
+            } else {
+                liste.fusion[ecriture++] = liste.fusion[i];
+            }
+        }
+        liste.fusion.resize(ecriture);
+    }
+    return liste;
+}
+
+// Cherche le premier élément >= 'livre' à partir de 'debut' (recherche par bonds puis dichotomie).
+// Les listes étant triées, on n'a jamais besoin de revenir en arrière.
+static std::size_t avancerJusqua(const ListeTerme& liste, std::size_t debut, std::uint32_t livre) {
+    std::size_t pas = 1, fin = debut;
+    while (fin < liste.taille() && liste.livre(fin) < livre) {
+        debut = fin + 1;
+        fin += pas;
+        pas *= 2;
+    }
+    if (fin > liste.taille()) fin = liste.taille();
+    while (debut < fin) {
+        std::size_t milieu = (debut + fin) / 2;
+        if (liste.livre(milieu) < livre) debut = milieu + 1;
+        else fin = milieu;
+    }
+    return debut;
+}
+
+// ET : on parcourt la liste la plus courte et on vérifie chaque livre dans les autres.
+// Le coût dépend de la plus petite liste, même si un mot est présent dans tout le catalogue.
+static std::vector<Candidat> intersection(std::vector<ListeTerme>& listes) {
+    std::sort(listes.begin(), listes.end(),
+              [](const ListeTerme& a, const ListeTerme& b) { return a.taille() < b.taille(); });
+
+    std::vector<Candidat> resultat;
+    std::vector<std::size_t> positions(listes.size(), 0);
+    for (std::size_t i = 0; i < listes[0].taille(); i++) {
+        Candidat c = {listes[0].livre(i), listes[0].score(i)};
+        bool partout = true;
+        for (std::size_t l = 1; l < listes.size() && partout; l++) {
+            positions[l] = avancerJusqua(listes[l], positions[l], c.livre);
+            if (positions[l] < listes[l].taille() && listes[l].livre(positions[l]) == c.livre) {
+                c.score += listes[l].score(positions[l]);
+            } else {
+                partout = false;
+            }
+        }
+        if (partout) resultat.push_back(c);
+    }
+    return resultat;
+}
+
+// OU : fusion de toutes les listes, les scores des livres communs s'additionnent
+static std::vector<Candidat> reunion(const std::vector<ListeTerme>& listes) {
+    std::vector<Candidat> resultat;
+    for (const auto& liste : listes) {
+        for (std::size_t i = 0; i < liste.taille(); i++) resultat.push_back({liste.livre(i), liste.score(i)});
+    }
+    std::sort(resultat.begin(), resultat.end(),
+              [](const Candidat& a, const Candidat& b) { return a.livre < b.livre; });
+    std::size_t ecriture = 0;
+    for (std::size_t i = 0; i < resultat.size(); i++) {
+        if (ecriture > 0 && resultat[ecriture - 1].livre == resultat[i].livre) resultat[ecriture - 1].score += resultat[i].score;
+        else resultat[ecriture++] = resultat[i];
+    }
+    resultat.resize(ecriture);
+    return resultat;
+}
+
+std::vector<std::uint32_t> rechercherTexte(const IndexTexte& index, const std::string& requete) {
+    // 1. Analyse de la requête : opérateurs OU et termes (avec '*' final pour un préfixe)
+    bool modeOu = false;
+    std::vector<std::pair<std::string, bool>> termes; // (terme normalisé, préfixe ?)
+
+    std::istringstream flux(requete);
+    std::string brut;
+    while (flux >> brut) {
+        if (brut == "OU" || brut == "OR" || brut == "|") {
+            modeOu = true;
+            continue;
+        }
+        bool prefixe = (brut.back() == '*');
+        if (prefixe) brut.pop_back();
+        // Un mot comme "l'étranger" peut donner plusieurs termes ("l" et "etranger")
+        std::size_t avant = termes.size();
+        pourChaqueMot(normaliserTexte(brut), [&](const std::string& mot) {
+            termes.push_back({mot, false});
+        });
+        // Seul le dernier morceau du mot est un préfixe ("l'étr*" -> "l" et "etr*")
+        if (prefixe && termes.size() > avant) termes.back().second = true;
+    }
+    if (termes.empty()) return {};
+
+    // 2. Récupération de la liste de chaque terme, puis combinaison ET / OU
+    std::vector<ListeTerme> listes;
+    for (const auto& t : termes) listes.push_back(listePourTerme(index, t.first, t.second));
+    std::vector<Candidat> candidats = modeOu ? reunion(listes) : intersection(listes);
+
+    // 3. Classement : meilleur score d'abord, puis ordre du catalogue en cas d'égalité
+    std::sort(candidats.begin(), candidats.end(), [](const Candidat& a, const Candidat& b) {
+        if (a.score != b.score) return a.score > b.score;
+        return a.livre < b.livre;
+    });
+
+    std::vector<std::uint32_t> positions;
+    positions.reserve(candidats.size());
+    for (const auto& c : candidats) positions.push_back(c.livre);
+    return positions;
+}
@@ -0,0 +1,205 @@
+/**
+ * @file index_tris.cpp
+ * @brief Construction et mise à jour des ordres de tri du catalogue (voir index_tris.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <algorithm> // Pour std::sort, std::lower_bound
+#include "index_tris.hpp"
+
+// Préfixes à ignorer pour le tri par titre (tableau statique : construit une seule fois)
+static const std::string_view PREFIXES_TITRE[] = {
+    "LE ", "LA ", "L'", "LES ", "UN ", "UNE ", "DES ",
+    "D'", "J'", "QU'", "S'"
+};
+
+std::uint32_t longueurArticle(std::string_view titre) {
+    for (const auto& p : PREFIXES_TITRE) {
+        if (titre.size() >= p.size() && std::equal(p.begin(), p.end(), titre.begin(), [](char a, char c) {
+                return static_cast<unsigned char>(a) == majuscule(c);
+            })) {
+            return static_cast<std::uint32_t>(p.size());
+        }
+    }
+    return 0;
+}
+
+int comparerTitres(std::string_view a, std::size_t debutA, std::string_view b, std::size_t debutB) {
+    std::size_t i = debutA, j = debutB;
+    while (i < a.size() && j < b.size()) {
+        unsigned char ca = majuscule(a[i]), cb = majuscule(b[j]);
+        if (ca != cb) return ca < cb ? -1 : 1;
+        i++;
+        j++;
+    }
+    if (i < a.size()) return 1;
+    if (j < b.size()) return -1;
+    return 0;
+}
+
+// Caractères décoratifs d'un ISBN, ignorés comme dans normaliserIsbn
+static bool ignoreDansIsbn(char c) {
+    return c == '-' || c == ' ' || c == '\r';
+}
+
+int comparerIsbn(std::string_view a, std::string_view b) {
+    std::size_t i = 0, j = 0;
+    while (true) {
+        while (i < a.size() && ignoreDansIsbn(a[i])) i++;
+        while (j < b.size() && ignoreDansIsbn(b[j])) j++;
+        if (i == a.size() || j == b.size()) break;
+        unsigned char ca = majuscule(a[i]), cb = majuscule(b[j]);
+        if (ca != cb) return ca < cb ? -1 : 1;
+        i++;
+        j++;
+    }
+    if (i < a.size()) return 1;
+    if (j < b.size()) return -1;
+    return 0;
+}
+
+// Date pour le tri : les dates invalides (0) passent après toutes les autres
+static std::uint32_t cleDate(const LivreCompact& livre) {
+    return livre.date == 0 ? 0xFFFFFFFF : livre.date;
+}
+
+// Compare les livres 'a' et 'b' selon 'ordre' (0 si leurs clés sont égales)
+static int comparerLivres(OrdreTri ordre, const CatalogueCompact& livres, std::uint32_t a, std::uint32_t b) {
+    switch (ordre) {
+        case TRI_TITRE: {
+            std::string_view ta = livres[a].title, tb = livres[b].title;
+            return comparerTitres(ta, longueurArticle(ta), tb, longueurArticle(tb));
+        }
+        case TRI_AUTEUR:
+            return comparerTitres(livres[a].authors, 0, livres[b].authors, 0);
+        case TRI_DATE: {
+            std::uint32_t da = cleDate(livres.livres[a]), db = cleDate(livres.livres[b]);
+            return da < db ? -1 : (da > db ? 1 : 0);
+        }
+        default:
+            return comparerIsbn(livres[a].isbn, livres[b].isbn);
+    }
+}
+
+// Les 8 premiers caractères de la clé de tri, en majuscules, dans un entier (le premier
+// caractère dans l'octet de poids fort, complété par des 0) : comparer deux clés courtes
+// donne le même ordre que comparer les textes, tant qu'elles sont différentes.
+static std::uint64_t cleCourte(OrdreTri ordre, const CatalogueCompact& livres, std::uint32_t position) {
+    if (ordre == TRI_DATE) return cleDate(livres.livres[position]);
+
+    LivreVue livre = livres[position];
+    std::string_view texte = (ordre == TRI_TITRE) ? livre.title : (ordre == TRI_AUTEUR) ? livre.authors : livre.isbn;
+    std::size_t i = (ordre == TRI_TITRE) ? longueurArticle(texte) : 0;
+    std::uint64_t cle = 0;
+    int pris = 0;
+    for (; i < texte.size() && pris < 8; i++) {
+        if (ordre == TRI_ISBN && ignoreDansIsbn(texte[i])) continue;
+        cle = (cle << 8) | majuscule(texte[i]);
+        pris++;
+    }
+    for (; pris < 8; pris++) cle <<= 8;
+    return cle;
+}
+
+// Un livre pendant la construction : sa clé courte et sa position
+struct EntreeTri {
+    std::uint64_t cle;
+    std::uint32_t livre;
+};
+
+// Trie des entrées : clé courte, puis texte complet si besoin, puis position
+static void trierEntrees(OrdreTri ordre, const CatalogueCompact& livres, std::vector<EntreeTri>& entrees) {
+    std::sort(entrees.begin(), entrees.end(), [ordre, &livres](const EntreeTri& a, const EntreeTri& b) {
+        if (a.cle != b.cle) return a.cle < b.cle;
+        int diff = comparerLivres(ordre, livres, a.livre, b.livre);
+        if (diff != 0) return diff < 0;
+        return a.livre < b.livre;
+    });
+}
+
+// Entrées (clé courte + position) des livres 'positions', triées
+static std::vector<EntreeTri> entreesTriees(OrdreTri ordre, const CatalogueCompact& livres, const std::vector<std::uint32_t>& positions) {
+    std::vector<EntreeTri> entrees(positions.size());
+    for (std::size_t i = 0; i < positions.size(); i++) {
+        entrees[i] = {cleCourte(ordre, livres, positions[i]), positions[i]};
+    }
+    trierEntrees(ordre, livres, entrees);
+    return entrees;
+}
+
+// rangs[position] = place du livre dans l'ordre (refait après chaque changement de l'ordre)
+static void calculerRangs(IndexTri& tri) {
+    tri.rangs.resize(tri.ordre.size());
+    for (std::size_t i = 0; i < tri.ordre.size(); i++) tri.rangs[tri.ordre[i]] = static_cast<std::uint32_t>(i);
+}
+
+void indexerTris(IndexTris& index, std::uint32_t position) {
+    for (IndexTri& tri : index.parOrdre) {
+        if (tri.construit) tri.enAttente.push_back(position);
+    }
+}
+
+void viderIndexTris(IndexTris& index) {
+    index = IndexTris();
+}
+
+std::vector<std::uint32_t> ordreDuCatalogue(OrdreTri ordre, const CatalogueCompact& livres) {
+    std::vector<std::uint32_t> tous(livres.size());
+    for (std::size_t i = 0; i < tous.size(); i++) tous[i] = static_cast<std::uint32_t>(i);
+    std::vector<EntreeTri> entrees = entreesTriees(ordre, livres, tous);
+    for (std::size_t i = 0; i < entrees.size(); i++) tous[i] = entrees[i].livre;
+    return tous;
+}
+
+const IndexTri& preparerIndexTri(IndexTris& index, OrdreTri ordre, const CatalogueCompact& livres) {
+    IndexTri& tri = index.parOrdre[ordre];
+    if (!tri.construit) {
+        tri.ordre = ordreDuCatalogue(ordre, livres);
+        tri.enAttente.clear();
+        tri.construit = true;
+        calculerRangs(tri);
+        return tri;
+    }
+    if (tri.enAttente.empty()) return tri;
+
+    // Les nouveaux livres sont triés entre eux, puis chacun est placé dans l'ordre existant par
+    // une recherche dichotomique : quelques comparaisons de textes par nouveau livre, et une
+    // seule recopie de l'ordre pour tout le lot.
+    std::vector<EntreeTri> nouveaux = entreesTriees(ordre, livres, tri.enAttente);
+    auto avant = [ordre, &livres](std::uint32_t a, std::uint32_t b) {
+        int diff = comparerLivres(ordre, livres, a, b);
+        return diff != 0 ? diff < 0 : a < b;
+    };
+    std::vector<std::uint32_t> fusion;
+    fusion.reserve(tri.ordre.size() + nouveaux.size());
+    auto suivant = tri.ordre.begin();
+    for (const EntreeTri& nouveau : nouveaux) {
+        auto place = std::lower_bound(suivant, tri.ordre.end(), nouveau.livre, avant);
+        fusion.insert(fusion.end(), suivant, place);
+        fusion.push_back(nouveau.livre);
+        suivant = place;
+    }
+    fusion.insert(fusion.end(), suivant, tri.ordre.end());
+    tri.ordre.swap(fusion);
+    tri.enAttente.clear();
+    calculerRangs(tri);
+    return tri;
+}
+
+void trierSelonIndex(const IndexTri& index, std::vector<std::uint32_t>& positions) {
+    if (positions.size() * 8 >= index.ordre.size()) {
+        // Grande liste : on marque ses livres, puis on relit l'index dans l'ordre (pas de tri)
+        std::vector<std::uint8_t> dansListe(index.ordre.size(), 0);
+        for (std::uint32_t position : positions) dansListe[position] = 1;
+        std::size_t n = 0;
+        for (std::uint32_t position : index.ordre) {
+            if (dansListe[position]) positions[n++] = position;
+        }
+        return;
+    }
+    // Petite liste : on trie les rangs des livres (des entiers), puis on revient aux positions
+    for (std::uint32_t& position : positions) position = index.rangs[position];
+    std::sort(positions.begin(), positions.end());
+    for (std::uint32_t& rang : positions) rang = index.ordre[rang];
+}
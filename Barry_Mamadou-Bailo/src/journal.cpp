@@ -0,0 +1,212 @@
+/**
+ * @file journal.cpp
+ * @brief Écriture, relecture et compactage du journal (voir journal.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <atomic>
+#include <cstdlib>    // Pour std::atexit
+#include <filesystem> // Pour la taille et le renommage des fichiers
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include "journal.hpp"
+#include "csv.hpp"
+#include "fichier_atomique.hpp" // Pour synchroniserFichier
+#include "tampon_sortie.hpp"
+#include "import.hpp" // Pour remplirLivre
+
+namespace fs = std::filesystem;
+
+// Marque de fin d'enregistrement (voir journal.hpp)
+static const std::string FIN_OPERATION = ".";
+
+// Écrit une opération : le code, ses champs, puis la marque de fin
+static void ecrireOperation(TamponSortie& t, char code, std::initializer_list<std::string_view> champs) {
+    ecrire(t, std::string_view(&code, 1));
+    ecrire(t, ";");
+    for (std::string_view champ : champs) {
+        ecrireChampCSV(t, champ);
+        ecrire(t, ";");
+    }
+    ecrire(t, FIN_OPERATION);
+    ecrire(t, "\n");
+}
+
+bool ecrireJournal(Library& lib, const std::string& fichierDb) {
+    EtatJournal& etat = lib.journal;
+    bool metaModifiee = (lib.name != etat.nomEcrit || lib.description != etat.descriptionEcrite);
+    bool rienAEcrire = !etat.viderEnAttente && etat.suppressions.empty() && !metaModifiee
+                       && etat.livresEcrits == lib.books.size();
+    if (rienAEcrire) return true;
+
+    // Ouverture en ajout : le début du fichier n'est jamais relu ni réécrit
+    std::ofstream f(fichierDb + EXTENSION_JOURNAL, std::ios::app | std::ios::binary);
+    if (!f) return false;
+    TamponSortie t;
+    ouvrirTamponSortie(t, f);
+
+    // L'ordre compte : vidage, puis suppressions (de livres déjà écrits), puis ajouts (à la fin)
+    if (etat.viderEnAttente) ecrireOperation(t, 'C', {});
+    for (const auto& isbn : etat.suppressions) ecrireOperation(t, 'R', {isbn});
+    if (metaModifiee) ecrireOperation(t, 'M', {lib.name, lib.description});
+    for (std::size_t i = etat.livresEcrits; i < lib.books.size(); i++) {
+        LivreVue b = lib.books[i];
+        ecrireOperation(t, 'A', {b.isbn, b.title, b.language, b.authors, b.date, b.genre, b.description});
+    }
+
+    // La sauvegarde n'est terminée qu'une fois les données vraiment sur le disque
+    viderTamponSortie(t);
+    f.close();
+    if (f.fail() || !synchroniserFichier(fichierDb + EXTENSION_JOURNAL)) return false;
+    marquerCommeEcrit(lib);
+    return true;
+}
+
+long rejouerJournal(Library& lib, const std::string& cheminJournal) {
+    std::ifstream f(cheminJournal, std::ios::binary);
+    if (!f) return 0; // Pas de journal : rien à rejouer
+
+    LecteurCSV lecteur;
+    ouvrirLecteurCSV(lecteur, f, ';');
+    std::vector<std::string_view> champs;
+    std::vector<std::string_view> champsLivre;
+    LivreVue b;
+    long nbOperations = 0;
+    std::uint64_t finValide = 0;   // Fin de la dernière opération complète
+    bool ligneCoupee = false;
+
+    // Les suppressions ('R') sont regroupées : chacune ferait sinon un passage sur le catalogue
+    // et une reconstruction des index (k suppressions = k x N). Elles ne sont appliquées
+    // qu'une fois, à la fin, ou avant une opération qui dépend d'elles : un 'A' qui remet un
+    // ISBN supprimé (le livre est encore là), un 'C' (elles n'ont alors plus d'objet).
+    std::vector<std::string> suppressions;
+    std::unordered_set<std::string> isbnSupprimes; // Normalisés, pour reconnaître ces 'A'
+
+    while (lireEnregistrement(lecteur, champs)) {
+        // Ligne incomplète (arrêt brutal pendant l'écriture) : on s'arrête là
+        if (champs.size() < 2 || champs.back() != FIN_OPERATION || champs[0].size() != 1) {
+            ligneCoupee = true;
+            break;
+        }
+        finValide = positionLecteurCSV(lecteur);
+
+        switch (champs[0][0]) {
+            case 'A':
+                champsLivre.assign(champs.begin() + 1, champs.end() - 1);
+                if (!remplirLivre(b, champsLivre)) break;
+                if (!isbnSupprimes.empty() && isbnSupprimes.count(normaliserIsbn(b.isbn))) {
+                    supprimerLivres(lib, suppressions);
+                    suppressions.clear();
+                    isbnSupprimes.clear();
+                }
+                if (!isbnExiste(lib, b.isbn)) ajouterLivre(lib, b);
+                break;
+            case 'R':
+                if (isbnSupprimes.insert(normaliserIsbn(champs[1])).second) suppressions.emplace_back(champs[1]);
+                break;
+            case 'C':
+                suppressions.clear();
+                isbnSupprimes.clear();
+                supprimerToutesReferences(lib);
+                break;
+            case 'M':
+                if (champs.size() < 4) continue;
+                lib.name.assign(champs[1]);
+                lib.description.assign(champs[2]);
+                break;
+            default:
+                continue; // Opération inconnue (version future ?) : ignorée
+        }
+        nbOperations++;
+    }
+    supprimerLivres(lib, suppressions); // Toutes en un seul passage
+
+    // On coupe le morceau de ligne invalide : sinon les prochains ajouts seraient collés
+    // derrière (et un guillemet ouvert dans ce morceau "avalerait" les lignes suivantes).
+    if (ligneCoupee) {
+        f.close();
+        std::error_code erreur;
+        fs::resize_file(cheminJournal, finValide, erreur);
+    }
+    return nbOperations;
+}
+
+void marquerCommeEcrit(Library& lib) {
+    lib.journal.livresEcrits = lib.books.size();
+    lib.journal.viderEnAttente = false;
+    lib.journal.suppressions.clear();
+    lib.journal.nomEcrit = lib.name;
+    lib.journal.descriptionEcrite = lib.description;
+}
+
+void supprimerJournaux(const std::string& fichierDb) {
+    std::error_code erreur; // Version sans exception : un fichier absent n'est pas une erreur
+    fs::remove(fichierDb + EXTENSION_JOURNAL, erreur);
+    fs::remove(fichierDb + EXTENSION_COMPACTAGE, erreur);
+}
+
+// --- COMPACTAGE EN ARRIÈRE-PLAN ---
+
+static std::mutex verrouCompactage;       // Protège 'threadCompactage'
+static std::thread threadCompactage;
+static std::atomic<bool> compactageEnCours{false};
+
+// Travail du thread : fichier principal + journal mis de côté -> nouveau fichier principal.
+// Tout se fait à partir des fichiers, dans une Library à part : le programme continue
+// d'utiliser la sienne (et d'écrire dans le nouveau journal) pendant ce temps.
+static void compacter(std::string fichierDb) {
+    Library lib;
+    const std::string journal = fichierDb + EXTENSION_COMPACTAGE;
+
+    if (chargerInstantane(lib, fichierDb) == CHARGE_OK) {
+        rejouerJournal(lib, journal);
+        // ecrireInstantane remplace l'ancien fichier d'un seul coup (fichier temporaire) :
+        // en cas d'arrêt, on garde l'ancien fichier et le journal (rien n'est perdu).
+        if (ecrireInstantane(lib, fichierDb)) {
+            std::error_code erreur;
+            fs::remove(journal, erreur);
+        }
+    }
+    compactageEnCours = false;
+}
+
+void attendreCompactage() {
+    std::lock_guard<std::mutex> verrou(verrouCompactage);
+    if (threadCompactage.joinable()) threadCompactage.join();
+}
+
+void lancerCompactageSiNecessaire(const std::string& fichierDb) {
+    const std::string journal = fichierDb + EXTENSION_JOURNAL;
+    const std::string aCompacter = fichierDb + EXTENSION_COMPACTAGE;
+
+    std::error_code erreur;
+    std::uintmax_t tailleJournal = fs::file_size(journal, erreur);
+    if (erreur) return;
+    std::uintmax_t tailleDb = fs::file_size(fichierDb, erreur);
+    if (erreur) return;
+    if (tailleJournal < SEUIL_COMPACTAGE || tailleJournal < tailleDb / 4) return;
+
+    std::lock_guard<std::mutex> verrou(verrouCompactage);
+    if (compactageEnCours) return;
+    if (threadCompactage.joinable()) threadCompactage.join(); // Compactage précédent terminé
+
+    // Le journal actuel est mis de côté ; les prochaines sauvegardes en créeront un nouveau.
+    // (S'il en reste un d'un compactage interrompu, on termine d'abord celui-là.)
+    if (!fs::exists(aCompacter)) {
+        fs::rename(journal, aCompacter, erreur);
+        if (erreur) return;
+    }
+
+    // Le thread doit être terminé avant la fin du programme (std::exit compris)
+    static bool attenteEnregistree = false;
+    if (!attenteEnregistree) {
+        std::atexit(attendreCompactage);
+        attenteEnregistree = true;
+    }
+
+    compactageEnCours = true;
+    threadCompactage = std::thread(compacter, fichierDb);
+}
@@ -5,7 +5,7 @@
  * @version 1.0
  *
  * Contient les fonctions de manipulation des livres : ajout, suppression,
- * vérification d'ISBN, importation CSV et l'exportation du catalogue en HTML.
+ * vérification d'ISBN et importation CSV (l'export HTML est dans export_html.cpp).
  * Gère également la persistance des données via library.db.
  */
 
@@ -13,136 +13,384 @@
 #include <fstream>   // Pour lire/écrire dans les fichiers
 #include <vector>
 #include <string>
-#include <algorithm> // Pour std::sort (tri des livres) et std::replace
-#include <sstream>   // Pour std::istringstream (découpage des chaînes)
+#include <chrono>    // Pour mesurer la durée de l'import
+#include <cstdio>    // Pour std::snprintf (pied du fichier)
+#include <cstdlib>   // Pour std::strtoull
+#include <filesystem> // Pour savoir si le fichier principal existe déjà
 #include "library.hpp"
+#include "catalogue_bin.hpp"
+#include "csv.hpp"       // Découpage des lignes sans allocation
+#include "fichier_atomique.hpp" // Écriture par fichier temporaire + somme de contrôle
+#include "import.hpp"    // Import CSV en parallèle (et remplirLivre)
+#include "journal.hpp"   // Sauvegarde incrémentale
+#include "mesures.hpp"   // Statistiques de performance (Paramètres)
+#include "recherche_texte.hpp" // Recherche titre / éditeur par blocs de 16 ou 32 octets
 #include "utils.hpp" 
 
-// Fonction utilitaire interne pour découper une ligne CSV.
-// Elle sépare la chaîne 's' à chaque fois qu'elle rencontre le 'delimiter' (ici ';').
-std::vector<std::string> splitLigne(const std::string& s, char delimiter) {
-    std::vector<std::string> tokens;
-    std::string token;
-    std::istringstream tokenStream(s);
-    
-    // On lit flux par flux jusqu'au délimiteur
-    while (std::getline(tokenStream, token, delimiter)) {
-        tokens.push_back(token);
-    }
-    // Cas particulier : si la ligne finit par un point-virgule, on ajoute une chaîne vide
-    // pour garder le bon nombre de colonnes.
-    if (!s.empty() && s.back() == delimiter) {
-        tokens.push_back("");
+// Première ligne et pied du format texte (voir library.hpp)
+static const std::string ENTETE_TEXTE = "#BIBLIO;2";
+static const std::string DEBUT_PIED_TEXTE = "#SOMME;";
+static const std::size_t TAILLE_PIED_TEXTE = 7 + 16 + 1; // "#SOMME;" + 16 chiffres + '\n'
+
+// Écrit une ligne d'en-tête (nom, description) en la nettoyant au passage, sans copie.
+// C'est crucial pour ne pas casser le format : l'en-tête est relu ligne par ligne,
+// donc un saut de ligne dans la description créerait une ligne fantôme.
+static void ecrireLigneNettoyee(TamponSortie& t, const std::string& texte) {
+    std::string_view reste = texte;
+    for (std::size_t i = reste.find_first_of("\r\n"); i != std::string_view::npos; i = reste.find_first_of("\r\n")) {
+        ecrire(t, reste.substr(0, i));
+        if (reste[i] == '\n') ecrire(t, " "); // On met tout sur une ligne
+        reste.remove_prefix(i + 1);            // Les retours chariot Windows sont enlevés
     }
-    return tokens;
+    ecrire(t, reste);
+    ecrire(t, "\n");
 }
 
-// Fonction pour nettoyer le texte avant sauvegarde.
-// C'est crucial pour ne pas casser le format CSV : si un titre contient un ';',
-// cela créerait une colonne fantôme. On le remplace par une virgule.
-std::string nettoyerTexte(std::string s) {
-    std::replace(s.begin(), s.end(), ';', ',');  // Sécurité CSV
-    std::replace(s.begin(), s.end(), '\n', ' '); // On met tout sur une ligne
-    // On enlève aussi les retours chariot Windows (\r) si présents
-    s.erase(std::remove(s.begin(), s.end(), '\r'), s.end());
-    return s;
+// Vérifie le pied d'un fichier texte : la somme de contrôle qu'il contient doit être
+// celle de tout ce qui le précède. Un fichier coupé n'a pas de pied (ou un pied faux).
+static bool verifierPiedTexte(const std::string& filename) {
+    std::error_code erreur;
+    std::uintmax_t taille = std::filesystem::file_size(filename, erreur);
+    if (erreur || taille < TAILLE_PIED_TEXTE) return false;
+
+    std::ifstream fichier(filename, std::ios::binary);
+    fichier.seekg(static_cast<std::streamoff>(taille - TAILLE_PIED_TEXTE));
+    std::string pied(TAILLE_PIED_TEXTE, '\0');
+    if (!fichier.read(&pied[0], static_cast<std::streamsize>(pied.size()))) return false;
+    if (pied.compare(0, DEBUT_PIED_TEXTE.size(), DEBUT_PIED_TEXTE) != 0 || pied.back() != '\n') return false;
+
+    char* finNombre = nullptr;
+    const char* chiffres = pied.c_str() + DEBUT_PIED_TEXTE.size();
+    std::uint64_t attendue = std::strtoull(chiffres, &finNombre, 16);
+    if (finNombre != chiffres + 16) return false;
+
+    std::uint64_t calculee = 0;
+    return sommeFichier(filename, taille - TAILLE_PIED_TEXTE, calculee) && calculee == attendue;
 }
 
-bool chargerBibliotheque(Library& lib, const std::string& filename) {
+ResultatChargement chargerInstantane(Library& lib, const std::string& filename) {
+    // Format binaire : lecture directe par projection mémoire, sans découpage de lignes
+    if (estCatalogueBinaire(filename)) {
+        return chargerCatalogueBinaire(lib, filename) ? CHARGE_OK : CHARGE_CORROMPU;
+    }
+
     std::ifstream fichier(filename);
-    if (!fichier.is_open()) return false; // Le fichier n'existe pas encore
+    if (!fichier.is_open()) return CHARGE_ABSENT; // Le fichier n'existe pas encore
+    lib.formatBinaire = false;
 
-    // 1. Lecture de l'en-tête (Nom et Description sur les 2 premières lignes)
-    if (!std::getline(fichier, lib.name)) lib.name = "Ma Bibliothèque";
+    // 1. Lecture de l'en-tête (Nom et Description sur les 2 premières lignes).
+    // Les fichiers récents commencent par ENTETE_TEXTE : on vérifie alors la somme de
+    // contrôle AVANT de toucher à 'lib', pour ne rien charger d'un fichier abîmé.
+    std::string premiereLigne;
+    bool lu = static_cast<bool>(std::getline(fichier, premiereLigne));
+    bool avecEntete = lu && premiereLigne == ENTETE_TEXTE;
+    if (avecEntete) {
+        if (!verifierPiedTexte(filename)) return CHARGE_CORROMPU;
+        lu = static_cast<bool>(std::getline(fichier, premiereLigne));
+    }
+    lib.name = lu ? premiereLigne : "Ma Bibliothèque";
     if (!std::getline(fichier, lib.description)) lib.description = "Description par défaut";
 
     // 2. Lecture des livres
-    lib.books.clear(); // On vide la liste avant de charger pour éviter les doublons
-    std::string line;
-    
-    while (std::getline(fichier, line)) {
-        if (line.empty()) continue; // On ignore les lignes vides
-
-        // On découpe la ligne en morceaux grâce aux points-virgules
-        std::vector<std::string> data = splitLigne(line, ';');
-        
-        // On vérifie qu'on a au moins 6 colonnes pour créer un livre valide
-        if (data.size() >= 6) {
-            Book b;
-            b.isbn = data[0];
-            b.title = data[1];
-            b.language = data[2];
-            b.authors = data[3];
-            b.date = data[4];
-            b.genre = data[5];
-            
-            // La description est optionnelle, mais si elle est là, on la prend
-            if (data.size() > 6) b.description = data[6];
-            else b.description = "";
-
-            lib.books.push_back(b);
+    supprimerToutesReferences(lib); // On vide la liste (et les index) avant de charger pour éviter les doublons
+
+    // Le reste du fichier est lu par blocs : chaque ligne est découpée sans allocation.
+    // (Le pied n'a que 2 colonnes : remplirLivre l'ignore comme une ligne invalide.)
+    // Un ancien fichier, sans en-tête, a été écrit sans guillemets : un " en début de champ
+    // y est du texte, et ne doit pas avaler les lignes suivantes.
+    LecteurCSV lecteur;
+    ouvrirLecteurCSV(lecteur, fichier, ';', avecEntete);
+    std::vector<std::string_view> champs;
+    LivreVue b; // Vues sur la ligne lue : le texte n'est copié qu'une fois, dans le catalogue
+
+    while (lireEnregistrement(lecteur, champs)) {
+        // On ignore les lignes vides et celles qui ont moins de 6 colonnes
+        if (remplirLivre(b, champs)) {
+            ajouterLivre(lib, b);
         }
     }
 
+    return CHARGE_OK;
+}
+
+ResultatChargement chargerBibliotheque(Library& lib, const std::string& filename) {
+    MesureEnCours mesure(MESURE_CHARGEMENT);
+    ResultatChargement resultat = chargerInstantane(lib, filename);
+    if (resultat != CHARGE_OK) return resultat;
+
+    // On rejoue les modifications sauvegardées depuis la dernière réécriture complète :
+    // d'abord un éventuel journal en cours de compactage, puis le journal actuel.
+    rejouerJournal(lib, filename + EXTENSION_COMPACTAGE);
+    rejouerJournal(lib, filename + EXTENSION_JOURNAL);
+    marquerCommeEcrit(lib);
+
+    if (mesure.active) {
+        compterLignes(mesure, lib.books.size());
+        compterOctets(mesure, tailleFichierMesure(filename) + tailleFichierMesure(filename + EXTENSION_COMPACTAGE)
+                              + tailleFichierMesure(filename + EXTENSION_JOURNAL));
+    }
+    return CHARGE_OK;
+}
+
+bool ecrireInstantane(const Library& lib, const std::string& filename) {
+    // Le texte d'un catalogue binaire n'est pas relu au chargement : on vérifie sa somme
+    // avant de le recopier, pour ne jamais remplacer un fichier abîmé par un fichier "sain"
+    if (!verifierTas(lib.books)) {
+        std::cerr << "Erreur : le catalogue chargé est abîmé (somme de contrôle du texte fausse), "
+                  << filename << " n'est pas réécrit" << std::endl;
+        return false;
+    }
+
+    // On conserve le format d'origine du fichier
+    if (lib.formatBinaire) return sauvegarderCatalogueBinaire(lib, filename);
+
+    // On écrit dans 'library.db.tmp' : library.db n'est remplacé qu'une fois le nouveau complet
+    FichierAtomique f;
+    if (!ouvrirFichierAtomique(f, filename)) {
+        std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename << std::endl;
+        return false;
+    }
+    TamponSortie& t = f.tampon;
+
+    // En-tête : la marque du format, puis Nom et Description sur 2 lignes distinctes
+    ecrire(t, ENTETE_TEXTE);
+    ecrire(t, "\n");
+    ecrireLigneNettoyee(t, lib.name);
+    ecrireLigneNettoyee(t, lib.description);
+
+    // Livres : Chaque livre est écrit sur UNE SEULE ligne (format CSV).
+    // Les champs sont séparés par des points-virgules ';'.
+    // ecrireChampCSV ajoute des guillemets si un champ contient un ';', un saut de ligne
+    // ou un guillemet, pour qu'il soit relu à l'identique (aucune copie du champ).
+    for (const auto& livre : lib.books) {
+        ecrireChampCSV(t, livre.isbn); ecrire(t, ";");
+        ecrireChampCSV(t, livre.title); ecrire(t, ";");
+        ecrireChampCSV(t, livre.language); ecrire(t, ";");
+        ecrireChampCSV(t, livre.authors); ecrire(t, ";");
+        ecrireChampCSV(t, livre.date); ecrire(t, ";");
+        ecrireChampCSV(t, livre.genre); ecrire(t, ";");
+        ecrireChampCSV(t, livre.description); ecrire(t, "\n");
+    }
+
+    // Pied : la somme porte sur tout ce qui précède. Le tampon est vidé d'abord, car
+    // la somme n'est mise à jour qu'au moment où les données partent vers le fichier.
+    viderTamponSortie(t);
+    t.somme = nullptr;
+    char pied[TAILLE_PIED_TEXTE + 1];
+    std::snprintf(pied, sizeof(pied), "%s%016llx\n", DEBUT_PIED_TEXTE.c_str(),
+                  static_cast<unsigned long long>(valeurSomme(f.somme)));
+    ecrire(t, pied);
+
+    if (!validerFichierAtomique(f)) {
+        std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename << std::endl;
+        return false;
+    }
     return true;
 }
 
-void sauvegarderBibliotheque(const Library& lib, const std::string& filename) {
-    std::ofstream fichier(filename);
-    if (fichier) {
-        // En-tête : Nom et Description sur 2 lignes distinctes
-        fichier << nettoyerTexte(lib.name) << std::endl;
-        fichier << nettoyerTexte(lib.description) << std::endl;
-
-        // Livres : Chaque livre est écrit sur UNE SEULE ligne (format CSV).
-        // Les champs sont séparés par des points-virgules ';'.
-        for (const auto& livre : lib.books) {
-            fichier << nettoyerTexte(livre.isbn) << ";"
-                    << nettoyerTexte(livre.title) << ";"
-                    << nettoyerTexte(livre.language) << ";"
-                    << nettoyerTexte(livre.authors) << ";"
-                    << nettoyerTexte(livre.date) << ";"
-                    << nettoyerTexte(livre.genre) << ";"
-                    << nettoyerTexte(livre.description) << std::endl;
-        }
+bool sauvegarderInstantane(const Library& lib, const std::string& filename) {
+    if (!ecrireInstantane(lib, filename)) return false;
+    supprimerJournaux(filename); // Tout est maintenant dans le fichier principal
+    return true;
+}
 
+bool sauvegarderBibliotheque(Library& lib, const std::string& filename) {
+    MesureEnCours mesure(MESURE_SAUVEGARDE);
+    bool reussi;
+    if (std::filesystem::exists(filename)) {
+        // Cas normal : on n'écrit que ce qui a changé, à la fin du journal
+        std::uint64_t journalAvant = mesure.active ? tailleFichierMesure(filename + EXTENSION_JOURNAL) : 0;
+        if (lib.journal.livresEcrits < lib.books.size()) compterLignes(mesure, lib.books.size() - lib.journal.livresEcrits);
+        reussi = ecrireJournal(lib, filename);
+        if (mesure.active) compterOctets(mesure, tailleFichierMesure(filename + EXTENSION_JOURNAL) - journalAvant);
+        if (!reussi) std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename + EXTENSION_JOURNAL << std::endl;
     } else {
-        std::cerr << "Erreur : Impossible d'écrire dans le fichier " << filename << std::endl;
+        // Premier enregistrement : pas encore de fichier principal (l'erreur éventuelle est
+        // affichée par ecrireInstantane)
+        attendreCompactage();
+        reussi = sauvegarderInstantane(lib, filename);
+        if (reussi) marquerCommeEcrit(lib);
+        compterLignes(mesure, lib.books.size());
+        if (mesure.active) compterOctets(mesure, tailleFichierMesure(filename));
     }
+    if (!reussi) return false;
+    // Journal trop gros : on le fusionne dans le fichier principal, en arrière-plan
+    lancerCompactageSiNecessaire(filename);
+    return true;
 }
 
 void initialiserBibliotheque(Library& lib) {
     // Valeurs par défaut pour une nouvelle installation
     lib.name = "Ma Bibliothèque";
     lib.description = "Gestionnaire de livres personnel";
-    lib.books.clear();
+    supprimerToutesReferences(lib);
+}
+
+long trouverIsbn(Library& lib, std::string_view isbn) {
+    // Une recherche dans l'index au lieu de parcourir tous les livres
+    return chercherIsbn(lib.indexIsbn, lib.books, isbn);
+}
 
+bool isbnExiste(Library& lib, std::string_view isbn) {
+    return trouverIsbn(lib, isbn) != -1;
+}
 
+std::vector<std::uint32_t> rechercherPleinTexte(Library& lib, const std::string& requete) {
+    // Premier appel : on indexe tout le catalogue d'un coup (ensuite, ajouterLivre le tient à jour)
+    construireIndexTexte(lib.indexTexte, lib.books);
+    return rechercherTexte(lib.indexTexte, requete);
 }
 
-bool isbnExiste(const Library& lib, const std::string& isbn) {
-    // On parcourt tous les livres un par un
-    for (const auto& livre : lib.books) {
-        // Si on trouve l'ISBN, on renvoie vrai tout de suite
-        if (livre.isbn == isbn) return true;
+std::vector<std::uint32_t> rechercherApprochee(Library& lib, const std::string& requete) {
+    // Même principe que le plein texte : construit au premier appel, tenu à jour ensuite
+    construireIndexApproche(lib.indexApproche, lib.books);
+    return rechercherApproche(lib.indexApproche, requete);
+}
+
+CurseurRecherche rechercherTitre(const Library& lib, const std::string& texte) {
+    // Le motif est mis en minuscules une seule fois ; les titres sont lus sur place,
+    // sans copie, les majuscules étant ignorées pendant la comparaison (recherche_texte.hpp)
+    MotifRecherche motif = preparerMotif(texte, true);
+    return ouvrirCurseur(lib.books, [motif](const LivreVue& livre) {
+        return contientMotif(livre.title, motif);
+    });
+}
+
+CurseurRecherche rechercherCodeEditeur(Library& lib, const std::string& code) {
+    // Premier appel : chaque ISBN est découpé une fois (ensuite, ajouterLivre tient l'index à jour).
+    // Puis une recherche dichotomique par groupe au lieu de relire tous les ISBN.
+    preparerIndexEditeurs(lib.indexEditeurs, lib.books);
+    return curseurResultats(lib.books, chercherEditeur(lib.indexEditeurs, lib.books, code));
+}
+
+std::vector<std::uint32_t> filtrerLivres(Library& lib, const FiltreLivres& filtre) {
+    construireColonnes(lib.colonnes, lib.books);
+    std::vector<std::uint32_t> resultat = filtrerColonnes(lib.colonnes, filtre);
+
+    // Cas extrême : au-delà de 65 534 langues ou genres, les colonnes 16 bits ne distinguent
+    // plus les numéros. On revérifie alors les livres retenus dans le catalogue lui-même.
+    bool langueDeborde = filtre.langue >= NUMERO_DEBORDE;
+    bool genreDeborde = filtre.genre >= NUMERO_DEBORDE;
+    if (langueDeborde || genreDeborde) {
+        std::size_t gardes = 0;
+        for (std::uint32_t position : resultat) {
+            const LivreCompact& l = lib.books.livres[position];
+            if (langueDeborde && l.langue != static_cast<std::uint32_t>(filtre.langue)) continue;
+            if (genreDeborde && l.genre != static_cast<std::uint32_t>(filtre.genre)) continue;
+            resultat[gardes++] = position;
+        }
+        resultat.resize(gardes);
     }
-    return false; // Si on a fini la boucle sans trouver
+    return resultat;
+}
+
+TrancheDates livresEntreDates(Library& lib, std::uint32_t dateMin, std::uint32_t dateMax) {
+    preparerIndexDates(lib.indexDates, lib.books);
+    return chercherEntreDates(lib.indexDates, dateMin, dateMax);
+}
+
+const IndexFacettes& facettesDuCatalogue(Library& lib) {
+    construireIndexFacettes(lib.indexFacettes, lib.books);
+    return lib.indexFacettes;
+}
+
+const std::vector<std::uint32_t>& livresDansOrdre(Library& lib, OrdreTri ordre) {
+    return preparerIndexTri(lib.indexTris, ordre, lib.books).ordre;
+}
+
+void trierSelon(Library& lib, OrdreTri ordre, std::vector<std::uint32_t>& positions) {
+    trierSelonIndex(preparerIndexTri(lib.indexTris, ordre, lib.books), positions);
+}
+
+// Met à jour tous les index pour le livre situé à 'position' dans 'books'
+static void indexerLivre(Library& lib, std::size_t position) {
+    LivreVue livre = lib.books[position];
+    indexerIsbn(lib.indexIsbn, static_cast<std::uint32_t>(position), livre.isbn);
+    // L'index plein texte n'est tenu à jour que s'il a déjà été construit
+    if (lib.indexTexte.construit) indexerTexte(lib.indexTexte, static_cast<std::uint32_t>(position), livre);
+    if (lib.indexApproche.construit) indexerApproche(lib.indexApproche, static_cast<std::uint32_t>(position), livre);
+    // Même principe pour les colonnes des filtres
+    if (lib.colonnes.construit) ajouterAuxColonnes(lib.colonnes, lib.books.livres[position]);
+    if (lib.indexFacettes.construit) indexerFacettes(lib.indexFacettes, static_cast<std::uint32_t>(position), lib.books.livres[position]);
+    indexerDate(lib.indexDates, static_cast<std::uint32_t>(position), lib.books.livres[position].date);
+    indexerEditeur(lib.indexEditeurs, static_cast<std::uint32_t>(position), livre.isbn);
+    indexerTris(lib.indexTris, static_cast<std::uint32_t>(position));
+}
+
+void reconstruireIndex(Library& lib) {
+    viderIndexIsbn(lib.indexIsbn);
+    viderIndexTexte(lib.indexTexte);
+    viderIndexApproche(lib.indexApproche);
+    viderColonnes(lib.colonnes);
+    viderIndexDates(lib.indexDates);
+    viderIndexEditeurs(lib.indexEditeurs);
+    viderIndexFacettes(lib.indexFacettes);
+    viderIndexTris(lib.indexTris);
+    for (std::size_t i = 0; i < lib.books.size(); i++) indexerLivre(lib, i);
+}
+
+void ajouterLivre(Library& lib, const LivreVue& nouveauLivre) {
+    // Copie le texte du livre à la fin du catalogue
+    ajouterAuCatalogue(lib.books, nouveauLivre);
+    // Et on le référence dans les index
+    indexerLivre(lib, lib.books.size() - 1);
 }
 
 void ajouterLivre(Library& lib, const Book& nouveauLivre) {
-    // Ajoute le livre à la fin du vecteur dynamique
-    lib.books.push_back(nouveauLivre);
-    // On pourrait trier ici, mais on le fera plus tard si besoin
+    ajouterLivre(lib, vueLivre(nouveauLivre));
+}
+
+bool supprimerLivre(Library& lib, const std::string& isbn) {
+    return supprimerLivres(lib, {isbn}) == 1;
+}
+
+std::size_t supprimerLivres(Library& lib, const std::vector<std::string>& isbns) {
+    std::vector<bool> aRetirer(lib.books.size(), false);
+    std::size_t nombre = 0, dejaEcrits = 0;
+    for (const auto& isbn : isbns) {
+        long position = trouverIsbn(lib, isbn);
+        if (position < 0 || aRetirer[static_cast<std::size_t>(position)]) continue;
+        aRetirer[static_cast<std::size_t>(position)] = true;
+        nombre++;
+        // Un livre déjà écrit sur le disque doit être supprimé aussi dans le journal
+        if (static_cast<std::size_t>(position) < lib.journal.livresEcrits) {
+            lib.journal.suppressions.emplace_back(lib.books[position].isbn);
+            dejaEcrits++;
+        }
+    }
+    if (nombre == 0) return 0;
+
+    lib.journal.livresEcrits -= dejaEcrits;
+    retirerDuCatalogue(lib.books, aRetirer);
+    reconstruireIndex(lib); // Les positions des livres suivants ont changé
+    return nombre;
 }
 
 void supprimerToutesReferences(Library& lib) {
-    lib.books.clear(); // Vide le vecteur en mémoire
+    viderCatalogue(lib.books); // Vide le catalogue en mémoire (et rend la place du texte)
+    viderIndexIsbn(lib.indexIsbn); // Les index doivent être vidés en même temps
+    viderIndexTexte(lib.indexTexte);
+    viderIndexApproche(lib.indexApproche);
+    viderColonnes(lib.colonnes);
+    viderIndexDates(lib.indexDates);
+    viderIndexEditeurs(lib.indexEditeurs);
+    viderIndexFacettes(lib.indexFacettes);
+    viderIndexTris(lib.indexTris);
+
+    // Pour le journal : tout ce qui était sur le disque est à supprimer
+    lib.journal.viderEnAttente = true;
+    lib.journal.livresEcrits = 0;
+    lib.journal.suppressions.clear();
     
     // On ne sauvegarde plus automatiquement.
     // L'utilisateur devra confirmer la sauvegarde en quittant le menu.
 }
 
-int importerReferences(Library& lib, const std::string& filename) {
+int importerReferences(Library& lib, const std::string& filename, int nbThreads, RapportImport* rapport) {
+    MesureEnCours mesure(MESURE_IMPORT);
+    auto depart = std::chrono::steady_clock::now();
+    RapportImport bilan;
+
     std::ifstream fichier(filename);
     if (!fichier) return -1; // Erreur d'ouverture
 
@@ -162,35 +410,10 @@ int importerReferences(Library& lib, const std::string& filename) {
     
     // CAS 1 : C'est un CSV standard (avec point-virgule)
     if (!estFormatVertical) {
-        std::string ligne; 
-        std::getline(fichier, ligne); // On ignore la ligne d'en-tête (Titres des colonnes)
-
-        while (std::getline(fichier, ligne)) {
-            if (ligne.empty()) continue;
-            std::vector<std::string> data = splitLigne(ligne, ';');
-            
-            if (data.size() >= 6) {
-                Book b;
-                b.isbn = data[0];
-                b.title = data[1];
-                b.language = data[2];
-                b.authors = data[3];
-                b.date = data[4];
-                b.genre = data[5];
-                if (data.size() > 6) b.description = data[6];
-                
-                // Petit nettoyage : si la description est entourée de guillemets "", on les enlève
-                if (b.description.size() >= 2 && b.description.front() == '"') {
-                    b.description = b.description.substr(1, b.description.size()-2);
-                }
-
-                // On n'ajoute le livre que s'il n'existe pas déjà (pas de doublons)
-                if (!isbnExiste(lib, b.isbn)) {
-                    lib.books.push_back(b);
-                    compteur++;
-                }
-            }
-        }
+        // Lecture, découpage et validation répartis sur plusieurs threads ; les doublons
+        // sont éliminés dans l'ordre du fichier, donc le résultat ne dépend pas du nombre de threads.
+        // Les guillemets (ex: description "avec ; dedans") sont gérés par le découpage CSV.
+        compteur = importerCSV(lib, fichier, nbThreads, bilan);
     } 
     // CAS 2 : Lecture verticale (pour compatibilité avec d'anciens fichiers)
     else {
@@ -205,144 +428,22 @@ int importerReferences(Library& lib, const std::string& filename) {
             std::getline(fichier, b.description);
             std::getline(fichier, b.genre);       
 
+            bilan.lignes++;
             if (!isbnExiste(lib, b.isbn)) {
-                lib.books.push_back(b);
+                ajouterLivre(lib, b);
                 compteur++;
             }
         }
     }
 
+    bilan.secondes = std::chrono::duration<double>(std::chrono::steady_clock::now() - depart).count();
+    if (rapport != nullptr) *rapport = bilan;
+    compterLignes(mesure, bilan.lignes);
+    if (mesure.active) compterOctets(mesure, tailleFichierMesure(filename));
+
     // NOTE IMPORTANTE : On ne sauvegarde PAS automatiquement ici.
     // L'utilisateur doit choisir de sauvegarder en quittant le menu.
     // Cela permet d'annuler l'importation si on s'est trompé.
     
     return compteur;
 }
-
-// === EXPORT HTML ===
-
-// Nettoie le titre pour le tri alphabétique (enlève "Le", "La", met en majuscule...)
-std::string nettoyerTitrePourTri(std::string titre) {
-    // 1. Mettre en majuscules
-    std::string s = titre;
-    for (auto & c: s) c = toupper(c);
-
-    // 2. Liste des préfixes à ignorer pour le tri
-    const std::vector<std::string> prefixes = {
-        "LE ", "LA ", "L'", "LES ", "UN ", "UNE ", "DES ", 
-        "D'", "J'", "QU'", "S'"
-    };
-
-    // 3. Si le titre commence par un préfixe, on l'ignore
-    for (const auto& p : prefixes) {
-        if (s.substr(0, p.size()) == p) {
-            return s.substr(p.size()); // On retourne la suite du titre
-        }
-    }
-    return s;
-}
-
-// Fonction de comparaison utilisée par std::sort
-bool comparerLivres(const Book& a, const Book& b) {
-    return nettoyerTitrePourTri(a.title) < nettoyerTitrePourTri(b.title);
-}
-
-// === FONCTION PRINCIPALE D'EXPORT ===
-
-void exporterHTML(const Library& lib, const std::string& filename) {
-    // 1. On crée une copie locale de la liste pour la trier
-    // (on ne veut pas changer l'ordre dans l'application)
-    std::vector<Book> livresTries = lib.books;
-    
-    // 2. On trie cette liste avec notre règle spéciale
-    std::sort(livresTries.begin(), livresTries.end(), comparerLivres);
-
-    std::ofstream fichier(filename);
-    if (!fichier) {
-        std::cerr << "Erreur lors de la création du fichier HTML" << std::endl;
-        return;
-    }
-
-    // 2. Écriture de l'en-tête HTML standard
-    fichier << "<!DOCTYPE html>" << std::endl;
-    fichier << "<html lang='fr'>" << std::endl;
-    fichier << "<head>" << std::endl;
-    fichier << "<meta charset='UTF-8'>" << std::endl;
-    fichier << "<meta name='viewport' content='width=device-width, initial-scale=1.0'>" << std::endl;
-    fichier << "<title>" << lib.name << " - Catalogue</title>" << std::endl;
-    
-    // CSS Intégré (Pour que le fichier HTML soit autonome et joli)
-    fichier << "<style>" << std::endl;
-    fichier << "body { font-family: sans-serif; background-color: #f4f4f9; color: #333; margin: 20px; }" << std::endl;
-    fichier << ".container { max-width: 900px; margin: 0 auto; background: white; padding: 20px; box-shadow: 0 0 10px rgba(0,0,0,0.1); }" << std::endl;
-    fichier << "h1 { text-align: center; color: #2c3e50; }" << std::endl;
-    fichier << ".subtitle { text-align: center; color: #7f8c8d; font-style: italic; margin-bottom: 30px; }" << std::endl;
-    
-    // Style de la barre d'index (A B C D...)
-    fichier << ".index-bar { text-align: center; margin-bottom: 20px; }" << std::endl;
-    fichier << ".index-bar a { display: inline-block; padding: 5px 10px; margin: 2px; text-decoration: none; color: white; background-color: #3498db; border-radius: 4px; }" << std::endl;
-    
-    // Style des cartes de livres
-    fichier << "h2 { border-bottom: 2px solid #3498db; color: #3498db; margin-top: 30px; }" << std::endl;
-    fichier << ".livre-card { border-left: 5px solid #3498db; padding: 10px 15px; margin-bottom: 15px; background: #f9f9f9; }" << std::endl;
-    fichier << ".livre-titre { font-weight: bold; font-size: 1.1em; }" << std::endl;
-    fichier << ".livre-infos { font-size: 0.9em; color: #555; }" << std::endl;
-    fichier << "</style>" << std::endl;
-    fichier << "</head>" << std::endl;
-    
-    fichier << "<body>" << std::endl;
-    fichier << "<div class='container'>" << std::endl;
-    fichier << "<h1>" << lib.name << "</h1>" << std::endl;
-    fichier << "<p class='subtitle'>" << lib.description << "</p>" << std::endl;
-
-    // 3. Génération de l'index Alphabétique
-    fichier << "<div class='index-bar'>" << std::endl;
-    std::string lettresPresentes = "";
-    // On repère quelles lettres sont utilisées
-    for (const auto& livre : livresTries) {
-        std::string cle = nettoyerTitrePourTri(livre.title);
-        char premiereLettre = cle[0];
-        if (!isalpha(premiereLettre)) premiereLettre = '#';
-        if (lettresPresentes.find(premiereLettre) == std::string::npos) {
-            lettresPresentes += premiereLettre;
-        }
-    }
-    // On affiche les liens
-    std::string alphabet = "#ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-    for (char c : alphabet) {
-        if (lettresPresentes.find(c) != std::string::npos) {
-            fichier << "<a href='#section-" << c << "'>" << c << "</a>";
-        } else {
-            fichier << "<span>" << c << "</span>";
-        }
-    }
-    fichier << "</div>" << std::endl;
-
-    // 4. Génération du contenu (Livres)
-    char sectionActuelle = 0;
-    for (const auto& livre : livresTries) {
-        std::string cle = nettoyerTitrePourTri(livre.title);
-        char lettre = cle[0];
-        if (!isalpha(lettre)) lettre = '#';
-
-        // Si on change de lettre, on crée une nouvelle section
-        if (lettre != sectionActuelle) {
-            sectionActuelle = lettre;
-            fichier << "<h2 id='section-" << sectionActuelle << "'>" << sectionActuelle << "</h2>" << std::endl;
-        }
-
-        // Affichage du livre
-        fichier << "<div class='livre-card'>" << std::endl;
-        fichier << "<div class='livre-titre'>" << livre.title << "</div>" << std::endl;
-        fichier << "<div class='livre-infos'>" << std::endl;
-        fichier << "Par <strong>" << livre.authors << "</strong> &bull; ";
-        fichier << "ISBN: " << livre.isbn << " &bull; ";
-        fichier << livre.date << std::endl;
-        fichier << "</div>" << std::endl;
-        fichier << "</div>" << std::endl;
-    }
-
-    fichier << "</div>" << std::endl; // Fin container
-
-    fichier << "</body></html>" << std::endl;
-}
\ No newline at end of file
@@ -16,6 +16,10 @@
 #include "menu.hpp"
 #include "library.hpp"
 #include "config.hpp"
+#include "export_html.hpp"
+#include "commandes.hpp"
+#include "ecran.hpp"
+#include "mesures.hpp"
 
 
 // Fonction pour configurer la bibliothèque si library.db n'existe pas encore
@@ -58,7 +62,13 @@ void initialiserNouvelleBibliotheque(Library& lib, const AppConfig& config) {
     std::cin.get(); 
 }
 
-int main() {
+int main(int argc, char* argv[]) {
+
+    // Avec une commande (ex: ./app import livres.csv), pas de menu : voir commandes.hpp
+    if (argc > 1) return executerCommande(argc, argv);
+
+    // Menus : chaque écran est envoyé au terminal en une seule fois (voir ecran.hpp)
+    installerRenduEcran();
 
     // Nom du fichier de la base de données (persistance)
     const std::string dbFile = "library.db";
@@ -70,12 +80,23 @@ int main() {
         creerConfigDefaut(config);
         sauvegarderConfig(config, "app.conf");
     }
+    // Statistiques de performance (désactivées par défaut), activées avant le chargement pour le mesurer
+    activerMesures(config.mesures);
+    if (config.mesuresEnFichier) ecrireMesuresEnQuittant(FICHIER_MESURES);
 
     // 2. Chargement de la bibliothèque (les livres)
     Library maBiblio;
     
-    // On essaye de charger le fichier. La fonction renvoie false s'il n'existe pas.
-    if (!chargerBibliotheque(maBiblio, "library.db")) {
+    // On essaye de charger le fichier.
+    ResultatChargement chargement = chargerBibliotheque(maBiblio, "library.db");
+    if (chargement == CHARGE_CORROMPU) {
+        // Surtout ne pas continuer : la première sauvegarde écraserait le fichier abîmé
+        // (et ce qu'on pourrait encore en récupérer à la main).
+        std::cerr << RED << "Erreur : library.db est incomplet ou corrompu (somme de contrôle invalide)." << RESET << std::endl;
+        std::cerr << "Le fichier n'a pas été modifié. Restaurez une copie de sauvegarde ou déplacez-le pour repartir de zéro." << std::endl;
+        return 1;
+    }
+    if (chargement == CHARGE_ABSENT) {
         // Premier lancement : on lance l'initialisation guidée
         initialiserNouvelleBibliotheque(maBiblio, config);
         
@@ -121,14 +142,46 @@ int main() {
                 // Recherche filtrée
                 chercherReferences(maBiblio, config);
                 break;
-            case 4:
+            case 4: {
                 // Exportation vers une page Web
                 afficherHeader("EXPORT HTML", config); 
-                exporterHTML(maBiblio, "catalogue.html");
-                std::cout << ">> Export terminé ! Ouvrez 'catalogue.html' dans votre navigateur." << std::endl;
+                std::cout << "  " << CYAN << "[1]" << RESET << " Une seule page (catalogue.html)" << std::endl;
+                std::cout << "  " << CYAN << "[2]" << RESET << " Une page par lettre, paginée (dossier catalogue/) - pour les gros catalogues" << std::endl;
+                std::cout << "> Choix : ";
+                int typeExport = 1;
+                if (!(std::cin >> typeExport)) {
+                    std::cin.clear();
+                    typeExport = 1;
+                }
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+
+                if (typeExport == 2) {
+                    std::cout << "Livres par page (Entrée = " << LIVRES_PAR_PAGE_HTML << ") : ";
+                    std::string saisie;
+                    std::getline(std::cin, saisie);
+                    int livresParPage = LIVRES_PAR_PAGE_HTML;
+                    try {
+                        if (!saisie.empty()) livresParPage = std::stoi(saisie);
+                    } catch (...) {
+                        livresParPage = LIVRES_PAR_PAGE_HTML; // Saisie invalide : valeur par défaut
+                    }
+                    int nbFichiers = exporterHTMLParLettre(maBiblio, "catalogue", livresParPage);
+                    if (nbFichiers < 0) {
+                        printColor("Erreur : l'export a échoué.", 31);
+                    } else {
+                        std::cout << ">> Export terminé ! " << nbFichiers << " fichiers écrits. Ouvrez 'catalogue/index.html' dans votre navigateur." << std::endl;
+                    }
+                } else {
+                    if (!exporterHTML(maBiblio, "catalogue.html")) {
+                        printColor("Erreur : l'export a échoué.", 31);
+                    } else {
+                        std::cout << ">> Export terminé ! Ouvrez 'catalogue.html' dans votre navigateur." << std::endl;
+                    }
+                }
                 std::cout << "Appuyez sur Entrée...";
-                std::cin.ignore(); std::cin.get();
+                std::cin.get();
                 break;
+            }
             case 5:
                 // Configuration (Logo, Titre...)
                 gererParametres(maBiblio, config, aDesModifs); 
@@ -149,8 +202,8 @@ int main() {
                     std::cin >> sousChoix;
                     
                     if (sousChoix == 1) {
-                        sauvegarderBibliotheque(maBiblio, dbFile);
-                        printColor("Sauvegarde effectuée. Au revoir !", 32);
+                        if (sauvegarderBibliotheque(maBiblio, dbFile)) printColor("Sauvegarde effectuée. Au revoir !", 32);
+                        else printColor("Erreur : la sauvegarde a échoué.", 31);
                         // 'choix' reste à 6, donc on sortira de la boucle
                     }
                     else if (sousChoix == 2) {
@@ -11,6 +11,8 @@
  * - Gestion des paramètres visuels.
  */
 
+#include <algorithm> // Pour std::min
+#include <cctype>    // Pour std::toupper
 #include <iostream>
 #include <limits>
 #include <string> // Important pour std::to_string
@@ -19,6 +21,8 @@
 #include <iomanip> // Pour std::setw (mise en forme des colonnes)
 #include <cstdlib> // Pour std::exit()
 #include "config.hpp"
+#include "ecran.hpp"   // Pour envoyer un message avant une opération longue
+#include "mesures.hpp" // Statistiques de performance
 
 // ============================================================
 // FONCTIONS UTILITAIRES D'AFFICHAGE
@@ -40,7 +44,7 @@ std::string formaterCellule(std::string texte, int largeur) {
 }
 
 // Affiche la fiche complète d'un livre
-void afficherDetailsLivre(const Book& livre, const AppConfig& config) {
+void afficherDetailsLivre(const LivreVue& livre, const AppConfig& config) {
     afficherHeader("DÉTAILS DU LIVRE", config);
 
     // 1. Titre du livre avec icône et soulignement
@@ -84,39 +88,96 @@ void afficherDetailsLivre(const Book& livre, const AppConfig& config) {
     std::cin.get();
 }
 
+// Écran du parcours par facettes (défini plus bas), ouvert depuis la liste de consultation
+static void parcourirFacettes(Library& lib, const AppConfig& config);
+
+// Noms des ordres de tri, dans l'ordre de l'énumération OrdreTri (voir index_tris.hpp)
+static const std::string NOMS_ORDRES_TRI[NB_ORDRES_TRI] = {"titre", "auteur", "date de parution", "ISBN"};
+
+// Demande l'ordre d'affichage d'une liste. Retourne -1 pour l'ordre de la liste elle-même
+// (ajout, pertinence...), ou 'actuel' si la saisie est vide ou invalide.
+static int choisirOrdreTri(int actuel) {
+    std::cout << "\n  " << BOLD << "Trier la liste" << RESET << "\n";
+    std::cout << "    0. Ordre de la liste (ajout, pertinence...)\n";
+    for (int i = 0; i < NB_ORDRES_TRI; i++) {
+        std::cout << "    " << (i + 1) << ". Par " << NOMS_ORDRES_TRI[i] << "\n";
+    }
+    std::cout << "\n  Numéro (Entrée = ne rien changer) : ";
+    std::string saisie;
+    std::getline(std::cin, saisie);
+    try {
+        int numero = std::stoi(saisie);
+        if (numero >= 0 && numero <= NB_ORDRES_TRI) return numero - 1;
+    } catch (...) {} // Si ce n'est pas un nombre, l'ordre ne change pas
+    return actuel;
+}
+
 // CETTE FONCTION EST LE CŒUR DE L'AFFICHAGE (Réutilisée pour Consulter et Chercher)
-// Elle gère la pagination (page suivante/précédente)
-void afficherListePaginee(const Library& lib, const std::vector<Book>& livresAAfficher, std::string titreMenu, const AppConfig& config) {
+// Elle gère la pagination (page suivante/précédente).
+// 'Liste' est le catalogue lui-même, une liste de positions ou un curseur (voir plus bas) :
+// toutes s'utilisent de la même façon et aucun livre n'est copié.
+//  - charger(n) : s'assure que les n premiers livres sont connus (un curseur continue sa
+//    recherche jusque-là) et retourne le nombre de livres connus ;
+//  - complet()  : vrai si la liste est entière (le total est alors connu) ;
+//  - [i]        : le i-ème livre (déjà chargé) ;
+//  - position(i) : sa position dans lib.books (pour trier la liste avec [O]).
+// Une liste triée par [O] l'est une seule fois : ses positions sont lues directement dans
+// l'index du tri (tout le catalogue) ou triées par rang (résultats), puis chaque page n'est
+// qu'une tranche de ce tableau.
+template <typename Liste>
+static void afficherPages(Library& lib, const Liste& livresAAfficher, const std::string& titreMenu, const AppConfig& config) {
    
     int livresParPage = config.livresParPage; // Récupéré depuis la config
 
     int page = 0; // Page actuelle (commence à 0)
-    int totalLivres = livresAAfficher.size();
     bool continuer = true;
 
+    // Ordre choisi par [O] (-1 : ordre de la liste). 'vueTriee' pointe alors sur les positions
+    // des livres dans cet ordre (dans l'index du tri, ou dans 'positionsTriees').
+    int ordre = -1;
+    std::vector<std::uint32_t> positionsTriees;
+    const std::vector<std::uint32_t>* vueTriee = nullptr;
+    auto livreNumero = [&](std::size_t i) {
+        return vueTriee != nullptr ? lib.books[(*vueTriee)[i]] : livresAAfficher[i];
+    };
+
     while (continuer) {
+
+        // On ne cherche que ce qu'il faut pour la page (+ 1 livre pour savoir s'il y a une page suivante)
+        int totalLivres;
+        bool totalConnu = true;
+        if (vueTriee != nullptr) {
+            totalLivres = static_cast<int>(vueTriee->size());
+        } else {
+            totalLivres = static_cast<int>(livresAAfficher.charger(static_cast<std::size_t>((page + 1) * livresParPage + 1)));
+            totalConnu = livresAAfficher.complet();
+        }
       
         // ICI : On appelle le header AVEC la config (donc le logo s'affiche)
         afficherHeader(titreMenu, config);
 
         // Infos Bibliothèque (Maison + Titre) si on est dans le menu principal de consultation
         if (titreMenu == "CONSULTER LES RÉFÉRENCES") {
-            std::cout << "  🏠 " << YELLOW << BOLD << lib.name << RESET << std::endl;
-            std::cout << "      " << WHITE << lib.description << RESET << std::endl;
+            std::cout << "  🏠 " << YELLOW << BOLD << lib.name << RESET << "\n";
+            std::cout << "      " << WHITE << lib.description << RESET << "\n";
         }
         
-        // Compteur (affichera 0 si vide, ce qui est correct)
-        std::cout << "\n  Nombre de livres : " << BOLD << totalLivres << RESET << std::endl;
-        std::cout << "  " << repeat("-", 50) << std::endl;
-        std::cout << "  " << GREEN << ITALIC << "Références" << RESET << std::endl;
-        std::cout << "  " << repeat("-", 50) << std::endl;
+        // Compteur (affichera 0 si vide, ce qui est correct). Tant que la recherche n'est pas
+        // finie, on affiche ce qui est déjà trouvé suivi d'un '+'.
+        std::cout << "\n  Nombre de livres : " << BOLD << totalLivres << (totalConnu ? "" : "+") << RESET;
+        if (!totalConnu) std::cout << ITALIC << "  (recherche en cours, [T] pour tout compter)" << RESET;
+        if (ordre >= 0) std::cout << ITALIC << "  (triés par " << NOMS_ORDRES_TRI[ordre] << ")" << RESET;
+        std::cout << "\n";
+        std::cout << "  " << repeat("-", 50) << "\n";
+        std::cout << "  " << GREEN << ITALIC << "Références" << RESET << "\n";
+        std::cout << "  " << repeat("-", 50) << "\n";
 
         // 2. CAS PARTICULIER : SI VIDE
-        if (livresAAfficher.empty()) {
-            std::cout << "\n    (o_o)  Aucun livre dans cette liste pour l'instant.\n" << std::endl;
+        if (totalLivres == 0) {
+            std::cout << "\n    (o_o)  Aucun livre dans cette liste pour l'instant.\n\n";
             // On force la sortie de boucle
             continuer = false; 
-            std::cout << "  " << repeat("-", 50) << std::endl;
+            std::cout << "  " << repeat("-", 50) << "\n";
             std::cout << "  Appuyez sur Entrée pour revenir...";
             std::cin.get(); 
             return; // On quitte proprement la fonction
@@ -130,37 +191,42 @@ void afficherListePaginee(const Library& lib, const std::vector<Book>& livresAAf
 
         /// 4. BOUCLE D'AFFICHAGE (Style Liste)
         for (int i = debut; i < fin; ++i) {
-            const Book& b = livresAAfficher[i];
+            LivreVue b = livreNumero(static_cast<std::size_t>(i));
             
             // LIGNE 1 : Numéro - Icône - Titre - Auteur
             // Ex: 1. 📖 Titre par Auteur
             std::cout << "  " << std::setw(2) << (i + 1) << ". " 
                       << "📘 " << CYAN << BOLD << b.title << RESET 
-                      << " par " << WHITE << b.authors << RESET << std::endl;
+                      << " par " << WHITE << b.authors << RESET << "\n";
 
             // LIGNE 2 : Infos techniques avec le connecteur L
             // Ex:    └── ISBN: ... | Genre: ... | Parution: ...
             std::cout << "      " << "└── " 
                       << "ISBN: " << YELLOW << b.isbn << RESET << " | "
                       << "Genre: " << MAGENTA << b.genre << RESET << " | "
-                      << "Parution: " << BLUE << b.date << RESET << std::endl;
-            std::cout << std::endl; 
+                      << "Parution: " << BLUE << b.date << RESET << "\n";
+            std::cout << "\n";
         }
 
         // 4. PIED DE PAGE ET NAVIGATION
-        std::cout << "  " << repeat("-", 50) << std::endl;
+        std::cout << "  " << repeat("-", 50) << "\n";
         // Calcul du nombre total de pages (formule mathématique pour arrondir au supérieur)
         int nbPages = (totalLivres + livresParPage - 1) / livresParPage;
 
-        std::cout << "  Page " << (page + 1) << " / " << nbPages << std::endl;
+        std::cout << "  Page " << (page + 1) << " / ";
+        if (totalConnu) std::cout << nbPages << "\n";
+        else std::cout << "?\n";
         
         // Affichage conditionnel des boutons [P] et [S]
         if (page > 0)
-            std::cout << "  " << (debut) << ". Page précédente [P]" << std::endl;
+            std::cout << "  " << (debut) << ". Page précédente [P]\n";
         if (fin < totalLivres)
-        std::cout << "\n  " << (fin + 1) << ". Page suivante [S]" << std::endl;
+        std::cout << "\n  " << (fin + 1) << ". Page suivante [S]\n";
         
-        std::cout << "  " << (fin + 2) << ". Retour [Q]" << std::endl;
+        std::cout << "  Trier par titre, auteur, date, ISBN [O]\n";
+        if (!totalConnu || nbPages > 2) std::cout << "  Aller à la page [A]\n";
+        if (titreMenu == "CONSULTER LES RÉFÉRENCES") std::cout << "  Parcourir par genre, langue, décennie [F]\n";
+        std::cout << "  " << (fin + 2) << ". Retour [Q]\n";
         std::cout << "\n " << GREEN << "> Votre choix : " << RESET;
 
 
@@ -180,19 +246,123 @@ void afficherListePaginee(const Library& lib, const std::vector<Book>& livresAAf
         else if (choix == "q" || choix == "Q") { 
             continuer = false; // On sort de la boucle while
         }
+        else if ((choix == "f" || choix == "F") && titreMenu == "CONSULTER LES RÉFÉRENCES") {
+            parcourirFacettes(lib, config);
+        }
+        else if (choix == "t" || choix == "T") {
+            // Termine la recherche pour connaître le nombre total de résultats
+            livresAAfficher.charger(std::numeric_limits<std::size_t>::max());
+        }
+        else if (choix == "o" || choix == "O") {
+            int nouvelOrdre = choisirOrdreTri(ordre);
+            if (nouvelOrdre != ordre) {
+                ordre = nouvelOrdre;
+                vueTriee = nullptr;
+                page = 0;
+                if (ordre >= 0) {
+                    std::cout << "  Tri en cours..." << std::endl;
+                    envoyerEcran(); // Le premier tri d'un grand catalogue prend un moment
+                    // Toute la liste est nécessaire pour la trier (un curseur termine sa recherche)
+                    std::size_t total = livresAAfficher.charger(std::numeric_limits<std::size_t>::max());
+                    if (total == lib.books.size()) {
+                        // La liste contient tous les livres : l'index du tri est déjà la liste triée
+                        vueTriee = &livresDansOrdre(lib, static_cast<OrdreTri>(ordre));
+                    } else {
+                        positionsTriees.resize(total);
+                        for (std::size_t i = 0; i < total; i++) positionsTriees[i] = livresAAfficher.position(i);
+                        trierSelon(lib, static_cast<OrdreTri>(ordre), positionsTriees);
+                        vueTriee = &positionsTriees;
+                    }
+                }
+            }
+        }
+        else if (choix == "a" || choix == "A") {
+            std::cout << "  Numéro de la page : ";
+            std::string saisie;
+            std::getline(std::cin, saisie);
+            try {
+                int numero = std::stoi(saisie);
+                // La page existe si son premier livre existe (un curseur cherche jusque-là, pas plus loin)
+                std::size_t premier = numero >= 1 ? static_cast<std::size_t>(numero - 1) * static_cast<std::size_t>(livresParPage) : 0;
+                std::size_t connus = vueTriee != nullptr ? vueTriee->size() : livresAAfficher.charger(premier + 1);
+                if (numero >= 1 && premier < connus) page = numero - 1;
+                else printColor("Cette page n'existe pas.", RED);
+            } catch (...) {} // Si ce n'est pas un nombre, on reste sur la page
+        }
         else {
             // Tentative de conversion en numéro pour voir les détails d'un livre
             try {
                 int index = std::stoi(choix);
                 index--; // On passe de 1..N à 0..N-1 (car les tableaux commencent à 0)
-                if (index >= 0 && index < totalLivres) {
-                    afficherDetailsLivre(livresAAfficher[index], config);
+                std::size_t connus = vueTriee != nullptr ? vueTriee->size() : livresAAfficher.charger(static_cast<std::size_t>(index) + 1);
+                if (index >= 0 && static_cast<std::size_t>(index) < connus) {
+                    afficherDetailsLivre(livreNumero(static_cast<std::size_t>(index)), config);
                 }
             } catch (...) {} // Si ce n'est pas un nombre, on ne fait rien
         }
     }
 }
 
+// Le catalogue entier, pour afficherPages (liste complète dès le départ)
+struct LivresDuCatalogue {
+    const CatalogueCompact& livres;
+
+    std::size_t charger(std::size_t) const { return livres.size(); }
+    bool complet() const { return true; }
+    LivreVue operator[](std::size_t i) const { return livres[i]; }
+    std::uint32_t position(std::size_t i) const { return static_cast<std::uint32_t>(i); }
+};
+
+// Résultats d'une recherche vus comme une liste de livres : [i] va chercher dans le catalogue
+// le livre dont la position est la i-ème du résultat (seulement pour la page affichée).
+struct LivresParPosition {
+    const CatalogueCompact& livres;
+    const std::vector<std::uint32_t>& positions;
+
+    std::size_t charger(std::size_t) const { return positions.size(); }
+    bool complet() const { return true; }
+    LivreVue operator[](std::size_t i) const { return livres[positions[i]]; }
+    std::uint32_t position(std::size_t i) const { return positions[i]; }
+};
+
+// Même chose directement sur l'index des dates (positions déjà triées par date)
+struct LivresParDate {
+    const CatalogueCompact& livres;
+    const TrancheDates& tranche;
+
+    std::size_t charger(std::size_t) const { return tranche.size(); }
+    bool complet() const { return true; }
+    LivreVue operator[](std::size_t i) const { return livres[tranche.debut[i].livre]; }
+    std::uint32_t position(std::size_t i) const { return tranche.debut[i].livre; }
+};
+
+// Résultats d'un curseur : la recherche avance seulement quand une page le demande
+struct LivresParCurseur {
+    const CatalogueCompact& livres;
+    CurseurRecherche& curseur;
+
+    std::size_t charger(std::size_t nombre) const { return avancerCurseur(curseur, nombre); }
+    bool complet() const { return curseurTermine(curseur); }
+    LivreVue operator[](std::size_t i) const { return livres[curseur.trouves[i]]; }
+    std::uint32_t position(std::size_t i) const { return curseur.trouves[i]; }
+};
+
+void afficherListePaginee(Library& lib, const std::vector<std::uint32_t>& positions, std::string titreMenu, const AppConfig& config) {
+    afficherPages(lib, LivresParPosition{lib.books, positions}, titreMenu, config);
+}
+
+void afficherListePaginee(Library& lib, const TrancheDates& livresParDate, std::string titreMenu, const AppConfig& config) {
+    afficherPages(lib, LivresParDate{lib.books, livresParDate}, titreMenu, config);
+}
+
+void afficherListePaginee(Library& lib, CurseurRecherche& curseur, std::string titreMenu, const AppConfig& config) {
+    afficherPages(lib, LivresParCurseur{lib.books, curseur}, titreMenu, config);
+}
+
+void afficherListePaginee(Library& lib, const CatalogueCompact& livresAAfficher, std::string titreMenu, const AppConfig& config) {
+    afficherPages(lib, LivresDuCatalogue{livresAAfficher}, titreMenu, config);
+}
+
 // ============================================================
 // FONCTIONS PRINCIPALES DU MENU
 // ============================================================
@@ -214,67 +384,276 @@ void afficherMenuPrincipal(const AppConfig& config) {
 }
 
 // Fonction simplifiée grâce à notre refactorisation !
-void consulterReferences(const Library& lib, const AppConfig& config) {
+void consulterReferences(Library& lib, const AppConfig& config) {
 
-    // On passe simplement tous les livres à la fonction d'affichage
+    // On passe simplement tous les livres à la fonction d'affichage (sans les copier)
     afficherListePaginee(lib, lib.books, "CONSULTER LES RÉFÉRENCES", config);
 }
 
-void chercherReferences(const Library& lib, const AppConfig& config) {
+// Nombre maximum de valeurs proposées pour une facette (les premières de la liste)
+const std::size_t MAX_VALEURS_FACETTE = 40;
+
+// Texte affiché pour une valeur de facette (ex: "Roman", "FR", "1950-1959")
+static std::string nomValeurFacette(const Library& lib, Facette facette, long valeur) {
+    if (valeur < 0) return facette == FACETTE_GENRE ? "(tous)" : "(toutes)";
+    if (facette == FACETTE_GENRE) return std::string(lib.books.genres.valeurs[static_cast<std::size_t>(valeur)]);
+    if (facette == FACETTE_LANGUE) return std::string(lib.books.langues.valeurs[static_cast<std::size_t>(valeur)]);
+    if (valeur == DECENNIE_INCONNUE) return "date inconnue";
+    return std::to_string(valeur) + "-" + std::to_string(valeur + 9);
+}
+
+// Propose les valeurs d'une facette, avec le nombre de livres de chacune compte tenu des
+// autres choix, et enregistre la valeur choisie (Entrée = plus de choix pour cette facette)
+static void choisirValeurFacette(Library& lib, SelectionFacettes& selection, Facette facette, const std::string& nom) {
+    std::vector<CompteFacette> comptes = compterFacette(facettesDuCatalogue(lib), selection, facette);
+    std::size_t proposees = std::min(comptes.size(), MAX_VALEURS_FACETTE);
+
+    std::cout << "\n  " << BOLD << nom << RESET << ITALIC << " (nombre de livres avec les autres choix)" << RESET << "\n";
+    for (std::size_t i = 0; i < proposees; i++) {
+        std::cout << "    " << std::setw(2) << (i + 1) << ". " << nomValeurFacette(lib, facette, comptes[i].valeur)
+                  << " (" << comptes[i].livres << ")\n";
+    }
+    if (comptes.size() > proposees) std::cout << "    ... et " << (comptes.size() - proposees) << " autres\n";
+    if (comptes.empty()) std::cout << "    (aucune valeur)\n";
+
+    std::cout << "\n  Numéro (Entrée = tous) : ";
+    std::string saisie;
+    std::getline(std::cin, saisie);
+    if (saisie.empty()) {
+        selection.choix[facette] = -1;
+        return;
+    }
+    try {
+        int numero = std::stoi(saisie);
+        if (numero >= 1 && static_cast<std::size_t>(numero) <= proposees) selection.choix[facette] = comptes[numero - 1].valeur;
+    } catch (...) {} // Si ce n'est pas un nombre, le choix ne change pas
+}
+
+static void parcourirFacettes(Library& lib, const AppConfig& config) {
+    SelectionFacettes selection;
+    const std::string noms[NB_FACETTES] = {"Genre", "Langue", "Décennie"};
+    const std::string libelles[NB_FACETTES] = {"Genre    ", "Langue   ", "Décennie "}; // Alignés à l'écran (é = 2 octets)
+    const std::string touches[NB_FACETTES] = {"G", "L", "D"};
+
+    while (true) {
+        // Le nombre de livres de la sélection : un ET des bitmaps, sans relire le catalogue
+        std::uint32_t nombre = compterSelection(facettesDuCatalogue(lib), selection);
+
+        afficherHeader("PARCOURIR PAR GENRE, LANGUE, DÉCENNIE", config);
+        for (int f = 0; f < NB_FACETTES; f++) {
+            std::cout << "      " << CYAN << "[" << touches[f] << "]" << RESET << " " << libelles[f]
+                      << ": " << MAGENTA << nomValeurFacette(lib, static_cast<Facette>(f), selection.choix[f])
+                      << RESET << std::endl;
+        }
+        std::cout << "\n  Livres correspondants : " << BOLD << nombre << RESET << "\n\n";
+        std::cout << "      " << CYAN << "[A]" << RESET << " Afficher ces livres" << std::endl;
+        std::cout << "      " << CYAN << "[E]" << RESET << " Effacer les choix" << std::endl;
+        std::cout << "      " << CYAN << "[Q]" << RESET << " ↩️  Retour" << std::endl;
+        std::cout << "\n " << GREEN << "> Votre choix : " << RESET;
+
+        std::string choix;
+        std::cin >> choix;
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n'); // Vider le buffer
+        for (char& c : choix) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+
+        if (choix == "Q") return;
+        if (choix == "E") selection = SelectionFacettes();
+        for (int f = 0; f < NB_FACETTES; f++) {
+            if (choix == touches[f]) choisirValeurFacette(lib, selection, static_cast<Facette>(f), noms[f]);
+        }
+        if (choix == "A") {
+            if (selectionVide(selection)) {
+                afficherListePaginee(lib, lib.books, "PARCOURS PAR FACETTES", config);
+                continue;
+            }
+            std::vector<std::uint32_t> resultats;
+            {
+                MesureEnCours mesure(MESURE_RECHERCHE);
+                resultats = livresSelection(facettesDuCatalogue(lib), selection);
+                compterLignes(mesure, resultats.size());
+            }
+            afficherListePaginee(lib, resultats, "PARCOURS PAR FACETTES", config);
+        }
+    }
+}
+
+// Affiche les valeurs connues d'un dictionnaire, pour aider la saisie
+static void afficherValeurs(const std::string& nom, const Dictionnaire& dico) {
+    if (dico.valeurs.empty() || dico.valeurs.size() > 30) return; // Trop nombreuses pour un rappel
+    std::cout << "  " << ITALIC << nom << " : ";
+    for (std::size_t i = 0; i < dico.valeurs.size(); i++) {
+        std::cout << (i > 0 ? ", " : "") << dico.valeurs[i];
+    }
+    std::cout << RESET << std::endl;
+}
+
+// Lit une année (Entrée = pas de limite). Retourne 'parDefaut' si la saisie n'est pas un nombre.
+static int saisirAnnee(const std::string& question, int parDefaut) {
+    std::cout << question;
+    std::string saisie;
+    std::getline(std::cin, saisie);
+    try {
+        return saisie.empty() ? parDefaut : std::stoi(saisie);
+    } catch (...) {
+        return parDefaut;
+    }
+}
+
+// Lit une borne de date (voir borneDate). Entrée ou saisie invalide = pas de limite.
+static std::uint32_t saisirBorneDate(const std::string& question, bool fin) {
+    std::cout << question;
+    std::string saisie;
+    std::getline(std::cin, saisie);
+    std::uint32_t date = borneDate(saisie, fin);
+    if (date == 0) return fin ? 0xFFFFFFFF : 0;
+    return date;
+}
+
+// Demande les critères du filtre. Retourne false si le genre ou la langue n'existe pas.
+static bool saisirFiltre(const Library& lib, FiltreLivres& filtre) {
+    afficherValeurs("Genres connus", lib.books.genres);
+    std::cout << "Genre (Entrée = tous) : ";
+    std::string genre;
+    std::getline(std::cin, genre);
+    if (!genre.empty() && (filtre.genre = chercherValeur(lib.books.genres, genre)) < 0) return false;
+
+    afficherValeurs("Langues connues", lib.books.langues);
+    std::cout << "Langue (Entrée = toutes) : ";
+    std::string langue;
+    std::getline(std::cin, langue);
+    if (!langue.empty() && (filtre.langue = chercherValeur(lib.books.langues, langue)) < 0) return false;
+
+    int debut = saisirAnnee("Publié à partir de l'année (Entrée = pas de limite) : ", 0);
+    int fin = saisirAnnee("Publié jusqu'à l'année (Entrée = pas de limite) : ", 9999);
+    if (debut > 0 || fin < 9999) filtrerAnnees(filtre, debut, fin);
+    return true;
+}
+
+void chercherReferences(Library& lib, const AppConfig& config) {
     clearScreen();
     // Affiche le logo + titre
     afficherHeader("RECHERCHE", config);
     std::cout << "      " << CYAN << "[1]" << RESET << " Par ISBN" << std::endl;
     std::cout << "      " << CYAN << "[2]" << RESET << " Par Titre" << std::endl;
     std::cout << "      " << CYAN << "[3]" << RESET << " Par Code Éditeur" << std::endl;
-    std::cout << "      " << CYAN << "[4]" << RESET << " ↩️  Retour au menu principal" << std::endl;
-    std::cout << "      " << RED  << "[5]" << RESET << " 🚪 Quitter l'application" << std::endl;
+    std::cout << "      " << CYAN << "[4]" << RESET << " Plein texte (titre, auteurs, genre, description)" << std::endl;
+    std::cout << "      " << CYAN << "[5]" << RESET << " Approchée (titre, auteurs : fautes de frappe tolérées)" << std::endl;
+    std::cout << "      " << CYAN << "[6]" << RESET << " Filtrer (genre, langue, années de parution)" << std::endl;
+    std::cout << "      " << CYAN << "[7]" << RESET << " Par date de parution (entre deux dates, triés par date)" << std::endl;
+    std::cout << "      " << CYAN << "[8]" << RESET << " ↩️  Retour au menu principal" << std::endl;
+    std::cout << "      " << RED  << "[9]" << RESET << " 🚪 Quitter l'application" << std::endl;
     std::cout << "\n " << GREEN << "> Choix : " << RESET;
 
     int choix;
     std::cin >> choix;
     std::cin.ignore(); // Vider le buffer
 
-    if (choix == 4) return; // Retour au menu principal
-    if (choix == 5) {       // Quitter l'application directement
+    if (choix == 8) return; // Retour au menu principal
+    if (choix == 9) {       // Quitter l'application directement
         printColor("\n  Au revoir ! À bientôt.", GREEN);
         std::exit(0);
     }
 
+    if (choix == 6) {
+        // Le filtre ne compare pas de texte : il parcourt les colonnes d'entiers (voir colonnes.hpp)
+        FiltreLivres filtre;
+        if (!saisirFiltre(lib, filtre)) {
+            printColor("\n  Aucun livre n'a ce genre ou cette langue.", RED);
+            std::cout << "  Appuyez sur Entrée..."; std::cin.get();
+            return;
+        }
+        std::vector<std::uint32_t> resultats;
+        {
+            MesureEnCours mesure(MESURE_RECHERCHE); // Seule la recherche est mesurée, pas la saisie ni l'affichage
+            resultats = filtrerLivres(lib, filtre);
+            compterLignes(mesure, resultats.size());
+        }
+        if (!resultats.empty()) {
+            afficherListePaginee(lib, resultats, "RÉSULTATS DU FILTRE", config);
+        } else {
+            printColor("\n  Aucun résultat trouvé.", RED);
+            std::cout << "  Appuyez sur Entrée..."; std::cin.get();
+        }
+        return;
+    }
+
+    if (choix == 7) {
+        // Index trié des dates : les livres de l'intervalle sont trouvés par dichotomie, déjà dans l'ordre
+        std::uint32_t dateMin = saisirBorneDate("Publié à partir du (JJ/MM/AAAA ou AAAA, Entrée = pas de limite) : ", false);
+        std::uint32_t dateMax = saisirBorneDate("Publié jusqu'au (JJ/MM/AAAA ou AAAA, Entrée = pas de limite) : ", true);
+        TrancheDates tranche;
+        {
+            MesureEnCours mesure(MESURE_RECHERCHE);
+            tranche = livresEntreDates(lib, dateMin, dateMax);
+            compterLignes(mesure, tranche.size());
+        }
+        if (!tranche.empty()) {
+            afficherListePaginee(lib, tranche, "LIVRES PAR DATE DE PARUTION", config);
+        } else {
+            printColor("\n  Aucun livre publié dans cet intervalle.", RED);
+            std::cout << "  Appuyez sur Entrée..."; std::cin.get();
+        }
+        return;
+    }
+
+    if (choix == 4) {
+        // Petit rappel de la syntaxe des requêtes plein texte
+        std::cout << "  " << ITALIC << "Mots séparés par des espaces (tous requis), OU entre les mots pour l'un ou l'autre,"
+                  << "\n  * en fin de mot pour un préfixe (ex: baudel*)." << RESET << std::endl;
+    }
+    if (choix == 5) {
+        std::cout << "  " << ITALIC << "Un ou plusieurs mots du titre ou des auteurs, même mal orthographiés (ex: baudlaire)."
+                  << RESET << std::endl;
+    }
+    if (choix == 3) {
+        std::cout << "  " << ITALIC << "Code de l'éditeur (ex: 07), ou groupe-éditeur (ex: 2-07) ; les ISBN sans tirets sont aussi trouvés."
+                  << RESET << std::endl;
+    }
     std::cout << "Entrez votre recherche : ";
     std::string recherche;
     std::getline(std::cin, recherche);
 
-    // Vecteur qui contiendra les résultats trouvés
-    std::vector<Book> resultats;
-    std::string rechercheLower = toLower(recherche); // On met tout en minuscule pour comparer
-
-    for (const auto& livre : lib.books) {
-        bool correspond = false;
-
-        if (choix == 1) { 
-            // Recherche Exacte ISBN
-            if (livre.isbn == recherche) correspond = true;
+    if (choix == 2 || choix == 3) {
+        // Recherche Titre (contient le texte, insensible casse) : il faut lire les livres un par
+        // un. Le curseur ne cherche que ce qu'il faut pour la page affichée, la suite est
+        // cherchée quand on passe à la page suivante. Éditeur : tout est trouvé d'un coup dans
+        // l'index des éditeurs, le curseur est déjà au bout.
+        CurseurRecherche curseur = (choix == 2) ? rechercherTitre(lib, recherche) : rechercherCodeEditeur(lib, recherche);
+        std::size_t trouves;
+        {
+            // Mesuré : le temps jusqu'au premier résultat (la suite est cherchée page par page)
+            MesureEnCours mesure(MESURE_RECHERCHE);
+            trouves = avancerCurseur(curseur, 1);
+            compterLignes(mesure, trouves);
         }
-        else if (choix == 2) { 
-            // Recherche Titre (contient le texte, insensible casse)
-            // On cherche si le titre en minuscule contient la recherche en minuscule
-            if (toLower(livre.title).find(rechercheLower) != std::string::npos) {
-                correspond = true;
-            }
-        }
-        else if (choix == 3) {
-            // Recherche Éditeur (partie de l'ISBN)
-            // L'éditeur est généralement la 3ème partie : 978-2-XXX-...
-            // On simplifie : on regarde si l'ISBN contient "-CODE-"
-            if (livre.isbn.find("-" + recherche + "-") != std::string::npos) {
-                correspond = true;
-            }
+        if (trouves > 0) {
+            afficherListePaginee(lib, curseur, "RÉSULTATS DE RECHERCHE", config);
+        } else {
+            printColor("\n  Aucun résultat trouvé.", RED);
+            std::cout << "  Appuyez sur Entrée..."; std::cin.get();
         }
+        return;
+    }
 
-        if (correspond) {
-            resultats.push_back(livre); // On ajoute aux résultats
+    // Positions des livres trouvés dans lib.books : 4 octets par résultat, rien n'est copié
+    // (une recherche très large comme "a" ne double plus la mémoire occupée par le catalogue)
+    std::vector<std::uint32_t> resultats;
+    {
+        MesureEnCours mesure(MESURE_RECHERCHE);
+        if (choix == 1) {
+            // Recherche Exacte ISBN : une seule consultation de l'index, pas de parcours
+            long position = trouverIsbn(lib, recherche);
+            if (position != -1) resultats.push_back(static_cast<std::uint32_t>(position));
+        }
+        else if (choix == 4) {
+            // Recherche plein texte : l'index inversé donne directement les livres, classés par pertinence
+            resultats = rechercherPleinTexte(lib, recherche);
+        }
+        else if (choix == 5) {
+            // Recherche approchée : les trigrammes donnent les mots proches, puis leurs livres
+            resultats = rechercherApprochee(lib, recherche);
         }
+        compterLignes(mesure, resultats.size());
     }
 
     if (!resultats.empty()) {
@@ -398,14 +777,20 @@ void gererReferences(Library& lib,const AppConfig& config, bool& aDesModifs) {
                     std::getline(std::cin, nomFichier);
 
                     std::cout << "Importation en cours..." << std::endl;
+                    envoyerEcran(); // Affiché tout de suite, pas seulement une fois l'import fini
                     
-                    int resultat = importerReferences(lib, nomFichier);
+                    RapportImport rapport;
+                    int resultat = importerReferences(lib, nomFichier, config.threadsImport, &rapport);
                     
                     if (resultat == -1) {
                         printColor("Erreur : Impossible d'ouvrir le fichier !", 31);
                     } else {
                         // On utilise std::to_string pour concaténer le nombre avec le texte
                         printColor("Succès ! " + std::to_string(resultat) + " livres importés.", 32);
+                        // Débit de l'import (lignes lues par seconde)
+                        long debit = rapport.secondes > 0 ? static_cast<long>(rapport.lignes / rapport.secondes) : 0;
+                        std::cout << rapport.lignes << " lignes lues en " << rapport.secondes << " s ("
+                                  << debit << " lignes/s, " << rapport.threads << " thread(s))" << std::endl;
                         aDesModifs = true; // Signale la modification
                     }
                     std::cout << "Appuyez sur Entrée...";
@@ -435,8 +820,9 @@ void gererReferences(Library& lib,const AppConfig& config, bool& aDesModifs) {
             case 5: { // raccourci pour quitter
                if (aDesModifs) {
                     printColor("Sauvegarde automatique des modifications...", YELLOW);
-                    sauvegarderBibliotheque(lib, "library.db");
-                    printColor("(v) Sauvegarde réussie.", GREEN);
+                    envoyerEcran();
+                    if (sauvegarderBibliotheque(lib, "library.db")) printColor("(v) Sauvegarde réussie.", GREEN);
+                    else printColor("Erreur : la sauvegarde a échoué.", RED);
                 }
                 printColor("Au revoir !", GREEN); 
                 std::exit(0);
@@ -446,6 +832,44 @@ void gererReferences(Library& lib,const AppConfig& config, bool& aDesModifs) {
 }
 
 
+// Écran des statistiques de performance (Paramètres > 5) : rapport et réglages des mesures
+static void gererStatistiques(AppConfig& config) {
+    int choix = 0;
+    do {
+        clearScreen();
+        afficherHeader("STATISTIQUES DE PERFORMANCE", config);
+        if (!config.mesures) {
+            std::cout << "  " << ITALIC << "Mesures désactivées : les opérations ne sont pas chronométrées." << RESET << "\n\n";
+        }
+        ecrireRapportMesures(std::cout);
+        std::cout << "\n";
+        std::cout << "      " << CYAN << "[1]" << RESET << " " << (config.mesures ? "Désactiver" : "Activer") << " les mesures" << std::endl;
+        std::cout << "      " << CYAN << "[2]" << RESET << " Écrire le rapport dans " << FICHIER_MESURES << " en quittant ("
+                  << (config.mesuresEnFichier ? "oui" : "non") << ")" << std::endl;
+        std::cout << "      " << CYAN << "[3]" << RESET << " Remettre les compteurs à zéro" << std::endl;
+        std::cout << "      " << CYAN << "[4]" << RESET << " ↩️  Retour aux paramètres" << std::endl;
+        std::cout << "\n " << GREEN << "> Votre choix : " << RESET;
+
+        if (!(std::cin >> choix)) {
+            std::cin.clear(); std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            choix = 0;
+        }
+        std::cin.ignore();
+
+        if (choix == 1) {
+            config.mesures = !config.mesures;
+            activerMesures(config.mesures);
+            sauvegarderConfig(config, "app.conf");
+        } else if (choix == 2) {
+            config.mesuresEnFichier = !config.mesuresEnFichier;
+            ecrireMesuresEnQuittant(config.mesuresEnFichier ? FICHIER_MESURES : "");
+            sauvegarderConfig(config, "app.conf");
+        } else if (choix == 3) {
+            remettreMesuresAZero();
+        }
+    } while (choix != 4);
+}
+
 void gererParametres(Library& lib, AppConfig& config, bool& aDesModifs) {
     int choix = 0;
     do {
@@ -455,7 +879,11 @@ void gererParametres(Library& lib, AppConfig& config, bool& aDesModifs) {
         std::cout << "      " << CYAN << "[1]" << RESET << " 📝 Modifier titre/desc" << std::endl;
         std::cout << "      " << CYAN << "[2]" << RESET << " 📄 Livres par page (" << config.livresParPage << ")" << std::endl;
         std::cout << "      " << CYAN << "[3]" << RESET << " 🎨 Modifier le logo" << std::endl;
-        std::cout << "      " << CYAN << "[4]" << RESET << " ↩️  Retour au menu principal" << std::endl;
+        std::cout << "      " << CYAN << "[4]" << RESET << " 🧵 Threads d'importation ("
+                  << (config.threadsImport == 0 ? std::string("auto") : std::to_string(config.threadsImport)) << ")" << std::endl;
+        std::cout << "      " << CYAN << "[5]" << RESET << " 📊 Statistiques de performance ("
+                  << (config.mesures ? "activées" : "désactivées") << ")" << std::endl;
+        std::cout << "      " << CYAN << "[6]" << RESET << " ↩️  Retour au menu principal" << std::endl;
         std::cout << "\n " << GREEN << "> Votre choix : " << RESET;
 
         if (!(std::cin >> choix)) {
@@ -544,7 +972,7 @@ void gererParametres(Library& lib, AppConfig& config, bool& aDesModifs) {
                 } 
                 else if (subChoix == 2) {
                     // --- RESET PAR DÉFAUT ---
-                    creerConfigDefaut(config); // On recrée la config par défaut
+                    reinitialiserLogo(config); // Seul le logo change (pagination et threads d'import gardés)
                     sauvegarderConfig(config, "app.conf");
                     printColor("Logo par défaut restauré !", 32);
                 }
@@ -552,8 +980,25 @@ void gererParametres(Library& lib, AppConfig& config, bool& aDesModifs) {
                 std::cin.get(); // Pause
                 break;
             }
-            case 4: break;
-            case 5: { // Quitter avec sauvegarde si besoin
+            case 4: { // Threads de l'import CSV (Préférences App)
+                printColor("--- Paramétrer l'Import ---", 34);
+                std::cout << "Nombre de threads pour l'import (0 = automatique, 1 = sans parallélisme) : ";
+                int n;
+                if (std::cin >> n && n >= 0) {
+                    config.threadsImport = n;
+                    sauvegarderConfig(config, "app.conf");
+                    printColor("Paramètre sauvegardé !", 32);
+                } else {
+                    printColor("Erreur : Nombre invalide.", 31);
+                }
+                std::cin.ignore(); std::cin.get();
+                break;
+            }
+            case 5: // Statistiques de performance (Préférences App)
+                gererStatistiques(config);
+                break;
+            case 6: break;
+            case 7: { // Quitter avec sauvegarde si besoin
                if (aDesModifs) {
                     clearScreen();
                     printColor("=== MODIFICATIONS NON ENREGISTRÉES ===", 31); 
@@ -567,8 +1012,8 @@ void gererParametres(Library& lib, AppConfig& config, bool& aDesModifs) {
                     std::cin >> sousChoix;
                     
                     if (sousChoix == 1) {
-                        sauvegarderBibliotheque(lib, "library.db");
-                        printColor("Sauvegarde effectuée. Au revoir !", 32);
+                        if (sauvegarderBibliotheque(lib, "library.db")) printColor("Sauvegarde effectuée. Au revoir !", 32);
+                        else printColor("Erreur : la sauvegarde a échoué.", 31);
                         std::exit(0);
                     }
                     else if (sousChoix == 2) {
@@ -585,18 +1030,5 @@ void gererParametres(Library& lib, AppConfig& config, bool& aDesModifs) {
                 break;
             }
         }
-    } while (choix != 4);
+    } while (choix != 6);
 }
-
-
-
-
-
-
-
-
-
-
-
-
-
@@ -0,0 +1,143 @@
+/**
+ * @file mesures.cpp
+ * @brief Statistiques de performance (voir mesures.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <cstdlib>    // Pour std::malloc, std::free, std::atexit
+#include <filesystem> // Pour la taille des fichiers
+#include <fstream>
+#include <iomanip>    // Pour std::setw (colonnes du rapport)
+#include <new>        // Pour std::bad_alloc
+#include <sstream>
+#include "mesures.hpp"
+
+std::atomic<bool> mesuresActives{false};
+std::atomic<std::uint64_t> allocationsComptees{0};
+
+static StatsOperation statistiques[NB_OPERATIONS_MESUREES];
+static std::string fichierEnQuittant; // Vide : pas de rapport écrit à la fin du programme
+
+// --- COMPTAGE DES ALLOCATIONS ---
+// On remplace l'operator new de la bibliothèque standard (toutes les allocations du programme
+// y passent : std::string, std::vector...). Mesures désactivées, il ne coûte qu'un test.
+
+void* operator new(std::size_t taille) {
+    if (mesuresActives.load(std::memory_order_relaxed)) allocationsComptees.fetch_add(1, std::memory_order_relaxed);
+    if (void* memoire = std::malloc(taille == 0 ? 1 : taille)) return memoire;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memoire) noexcept { std::free(memoire); }
+void operator delete(void* memoire, std::size_t) noexcept { std::free(memoire); }
+
+// --- MESURES ---
+
+MesureEnCours::~MesureEnCours() {
+    if (!active) return;
+    std::uint64_t duree = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - debut).count());
+
+    StatsOperation& stats = statistiques[operation];
+    stats.appels++;
+    stats.lignes += lignes;
+    stats.octets += octets;
+    stats.allocations += allocationsComptees.load(std::memory_order_relaxed) - allocationsDebut;
+    stats.nanosecondes += duree;
+    if (duree > stats.maxNanosecondes) stats.maxNanosecondes = duree;
+
+    // Tranche = nombre de bits des microsecondes (0 µs -> 0, 1 µs -> 1, 2-3 µs -> 2, 4-7 µs -> 3...)
+    int tranche = 0;
+    for (std::uint64_t microsecondes = duree / 1000; microsecondes != 0; microsecondes >>= 1) tranche++;
+    if (tranche >= NB_TRANCHES_DUREE) tranche = NB_TRANCHES_DUREE - 1;
+    stats.tranches[tranche]++;
+}
+
+std::uint64_t tailleFichierMesure(const std::string& chemin) {
+    std::error_code erreur;
+    std::uintmax_t taille = std::filesystem::file_size(chemin, erreur);
+    return erreur ? 0 : static_cast<std::uint64_t>(taille);
+}
+
+void activerMesures(bool actives) {
+    mesuresActives.store(actives, std::memory_order_relaxed);
+}
+
+const StatsOperation& statsOperation(OperationMesuree operation) {
+    return statistiques[operation];
+}
+
+const char* nomOperation(OperationMesuree operation) {
+    static const char* noms[NB_OPERATIONS_MESUREES] = {"chargement", "sauvegarde", "import", "export_html", "recherche"};
+    return noms[operation];
+}
+
+void remettreMesuresAZero() {
+    for (auto& stats : statistiques) stats = StatsOperation();
+}
+
+// Durée lisible : "850 ns", "12.3 µs", "4.56 ms", "1.23 s"
+static std::string texteDuree(double nanosecondes) {
+    std::ostringstream texte;
+    texte << std::setprecision(3);
+    if (nanosecondes < 1e3) texte << nanosecondes << " ns";
+    else if (nanosecondes < 1e6) texte << nanosecondes / 1e3 << " µs";
+    else if (nanosecondes < 1e9) texte << nanosecondes / 1e6 << " ms";
+    else texte << nanosecondes / 1e9 << " s";
+    return texte.str();
+}
+
+// Texte complété par des espaces à gauche jusqu'à 'largeur' caractères.
+// (std::setw compte les octets : "µ" en UTF-8 en vaut deux et décalerait la colonne)
+static std::string aDroite(const std::string& texte, std::size_t largeur) {
+    std::size_t caracteres = 0;
+    for (unsigned char c : texte) caracteres += ((c & 0xC0) != 0x80); // Octets de suite UTF-8 non comptés
+    return std::string(caracteres < largeur ? largeur - caracteres : 0, ' ') + texte;
+}
+
+void ecrireRapportMesures(std::ostream& sortie) {
+    sortie << std::left << std::setw(13) << "Opération" << std::right << std::setw(8) << "Appels"
+           << std::setw(12) << "Moyenne" << std::setw(12) << "Max" << std::setw(12) << "Total"
+           << std::setw(13) << "Lignes" << std::setw(14) << "Octets" << std::setw(13) << "Allocations" << "\n";
+
+    for (int op = 0; op < NB_OPERATIONS_MESUREES; op++) {
+        const StatsOperation& stats = statistiques[op];
+        double moyenne = stats.appels ? static_cast<double>(stats.nanosecondes) / static_cast<double>(stats.appels) : 0;
+        sortie << std::left << std::setw(12) << nomOperation(static_cast<OperationMesuree>(op)) << std::right
+               << std::setw(8) << stats.appels << aDroite(texteDuree(moyenne), 12)
+               << aDroite(texteDuree(static_cast<double>(stats.maxNanosecondes)), 12)
+               << aDroite(texteDuree(static_cast<double>(stats.nanosecondes)), 12)
+               << std::setw(13) << stats.lignes << std::setw(14) << stats.octets << std::setw(13) << stats.allocations << "\n";
+    }
+
+    // Histogramme des durées de chaque opération appelée au moins une fois
+    for (int op = 0; op < NB_OPERATIONS_MESUREES; op++) {
+        const StatsOperation& stats = statistiques[op];
+        if (stats.appels == 0) continue;
+        sortie << "\nDurées de " << nomOperation(static_cast<OperationMesuree>(op)) << " :\n";
+        for (int tranche = 0; tranche < NB_TRANCHES_DUREE; tranche++) {
+            if (stats.tranches[tranche] == 0) continue;
+            // Barre proportionnelle à la part des appels (40 caractères = tous les appels)
+            std::size_t barre = static_cast<std::size_t>(stats.tranches[tranche] * 40 / stats.appels);
+            sortie << "  < " << aDroite(texteDuree(1000.0 * static_cast<double>(1ULL << tranche)), 9)
+                   << std::setw(10) << stats.tranches[tranche] << " " << std::string(barre == 0 ? 1 : barre, '#') << "\n";
+        }
+    }
+}
+
+// Appelée par std::exit ou à la fin de main (enregistrée avec std::atexit)
+static void ecrireFichierEnQuittant() {
+    if (fichierEnQuittant.empty()) return;
+    std::ofstream fichier(fichierEnQuittant);
+    if (fichier) ecrireRapportMesures(fichier);
+}
+
+void ecrireMesuresEnQuittant(const std::string& fichier) {
+    static bool enregistree = false;
+    if (!enregistree && !fichier.empty()) {
+        std::atexit(ecrireFichierEnQuittant);
+        enregistree = true;
+    }
+    fichierEnQuittant = fichier;
+}
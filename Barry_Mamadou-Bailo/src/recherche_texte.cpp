@@ -0,0 +1,231 @@
+/**
+ * @file recherche_texte.cpp
+ * @brief Recherche d'un texte dans un autre, scalaire / SSE2 / AVX2 (voir recherche_texte.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // Pour std::memcpy
+#include "recherche_texte.hpp"
+
+#ifdef __SSE2__
+    #include <emmintrin.h> // Instructions SSE2 (16 octets à la fois)
+#endif
+
+// AVX2 : compilé à part (attribut target), utilisé seulement si le processeur le permet
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define RECHERCHE_AVX2 1
+    #include <immintrin.h>
+#endif
+
+// Minuscule d'un octet : seules les lettres A-Z changent (comme std::tolower en locale "C")
+static inline char plier(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+}
+
+// Compare les octets du milieu du motif (le premier et le dernier sont déjà vérifiés)
+template <bool IgnorerCasse>
+static inline bool milieuEgal(const char* texte, const char* motif, std::size_t k) {
+    for (std::size_t j = 1; j + 1 < k; j++) {
+        char c = IgnorerCasse ? plier(texte[j]) : texte[j];
+        if (c != motif[j]) return false;
+    }
+    return true;
+}
+
+// Version simple : à partir de la position 'debut', un octet à la fois (k >= 1, k <= n)
+template <bool IgnorerCasse>
+static bool chercherDepuis(const char* t, std::size_t n, std::size_t debut, const char* p, std::size_t k) {
+    for (std::size_t i = debut; i + k <= n; i++) {
+        char premier = IgnorerCasse ? plier(t[i]) : t[i];
+        char dernier = IgnorerCasse ? plier(t[i + k - 1]) : t[i + k - 1];
+        if (premier == p[0] && dernier == p[k - 1] && milieuEgal<IgnorerCasse>(t + i, p, k)) return true;
+    }
+    return false;
+}
+
+template <bool IgnorerCasse>
+static bool contientScalaire(std::string_view texte, std::string_view motif) {
+    if (motif.empty()) return true;
+    if (texte.size() < motif.size()) return false;
+    return chercherDepuis<IgnorerCasse>(texte.data(), texte.size(), 0, motif.data(), motif.size());
+}
+
+// Vérifie les positions candidates (un bit par position à partir de 'base')
+template <bool IgnorerCasse>
+static inline bool verifierCandidats(std::uint64_t bits, const char* base, const char* p, std::size_t k) {
+    while (bits != 0) {
+        if (milieuEgal<IgnorerCasse>(base + __builtin_ctzll(bits), p, k)) return true;
+        bits &= bits - 1; // Efface le bit traité
+    }
+    return false;
+}
+
+// Les titres font le plus souvent moins de 32 octets : trop courts pour un bloc entier.
+// La fin du texte est donc recopiée dans un petit tampon de la pile, complété par des zéros,
+// où l'on peut lire un bloc entier sans sortir de la mémoire du texte (pas d'allocation).
+const std::size_t TAILLE_TAMPON_FIN = 96;
+
+#ifdef __SSE2__
+// Passe les octets A-Z d'un registre en minuscules. Les comparaisons SSE2 sont signées :
+// les octets >= 0x80 (UTF-8) sont négatifs, donc jamais entre 'A' et 'Z'.
+static inline __m128i plierSSE2(__m128i x) {
+    __m128i majuscule = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)),
+                                      _mm_cmplt_epi8(x, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(x, _mm_and_si128(majuscule, _mm_set1_epi8(0x20)));
+}
+
+// Un bit par position de départ (16 à partir de t) où la première ET la dernière lettre
+// du motif correspondent ; le bloc "fin" est lu k - 1 octets plus loin.
+template <bool IgnorerCasse>
+static inline unsigned candidatsSSE2(const char* t, std::size_t k, __m128i premier, __m128i dernier) {
+    __m128i debutBloc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t));
+    __m128i finBloc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(t + k - 1));
+    if (IgnorerCasse) {
+        debutBloc = plierSSE2(debutBloc);
+        finBloc = plierSSE2(finBloc);
+    }
+    return static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(debutBloc, premier), _mm_cmpeq_epi8(finBloc, dernier))));
+}
+
+template <bool IgnorerCasse>
+static bool contientSSE2(std::string_view texte, std::string_view motif) {
+    const std::size_t n = texte.size(), k = motif.size();
+    if (k == 0) return true;
+    if (n < k) return false;
+    const char* t = texte.data();
+    const char* p = motif.data();
+    const __m128i premier = _mm_set1_epi8(p[0]);
+    const __m128i dernier = _mm_set1_epi8(p[k - 1]);
+
+    // 16 positions de départ par tour, tant que le bloc "fin" reste dans le texte
+    std::size_t i = 0;
+    for (; i + k - 1 + 16 <= n; i += 16) {
+        if (verifierCandidats<IgnorerCasse>(candidatsSSE2<IgnorerCasse>(t + i, k, premier, dernier), t + i, p, k)) return true;
+    }
+
+    // La fin (moins de 16 positions) : un dernier bloc dans le tampon, si le motif y tient
+    const std::size_t reste = n - i;
+    if (reste < k) return false;
+    if (k - 1 + 16 > TAILLE_TAMPON_FIN) return chercherDepuis<IgnorerCasse>(t, n, i, p, k);
+    char tampon[TAILLE_TAMPON_FIN] = {};
+    std::memcpy(tampon, t + i, reste);
+    std::uint64_t bits = candidatsSSE2<IgnorerCasse>(tampon, k, premier, dernier);
+    bits &= (1ULL << (reste - k + 1)) - 1; // Seulement les positions où le motif tient dans le texte
+    return verifierCandidats<IgnorerCasse>(bits, tampon, p, k);
+}
+#endif
+
+#ifdef RECHERCHE_AVX2
+// Même principe que la version SSE2, 32 positions par tour
+__attribute__((target("avx2"))) static inline __m256i plierAVX2(__m256i x) {
+    __m256i majuscule = _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('A' - 1)),
+                                         _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), x));
+    return _mm256_or_si256(x, _mm256_and_si256(majuscule, _mm256_set1_epi8(0x20)));
+}
+
+template <bool IgnorerCasse>
+__attribute__((target("avx2"))) static inline unsigned candidatsAVX2(const char* t, std::size_t k, __m256i premier, __m256i dernier) {
+    __m256i debutBloc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t));
+    __m256i finBloc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t + k - 1));
+    if (IgnorerCasse) {
+        debutBloc = plierAVX2(debutBloc);
+        finBloc = plierAVX2(finBloc);
+    }
+    return static_cast<unsigned>(_mm256_movemask_epi8(
+        _mm256_and_si256(_mm256_cmpeq_epi8(debutBloc, premier), _mm256_cmpeq_epi8(finBloc, dernier))));
+}
+
+template <bool IgnorerCasse>
+__attribute__((target("avx2"))) static bool contientAVX2(std::string_view texte, std::string_view motif) {
+    const std::size_t n = texte.size(), k = motif.size();
+    if (k == 0) return true;
+    if (n < k) return false;
+    const char* t = texte.data();
+    const char* p = motif.data();
+    const __m256i premier = _mm256_set1_epi8(p[0]);
+    const __m256i dernier = _mm256_set1_epi8(p[k - 1]);
+
+    std::size_t i = 0;
+    for (; i + k - 1 + 32 <= n; i += 32) {
+        if (verifierCandidats<IgnorerCasse>(candidatsAVX2<IgnorerCasse>(t + i, k, premier, dernier), t + i, p, k)) return true;
+    }
+
+    const std::size_t reste = n - i;
+    if (reste < k) return false;
+    if (k - 1 + 32 > TAILLE_TAMPON_FIN) return chercherDepuis<IgnorerCasse>(t, n, i, p, k);
+    char tampon[TAILLE_TAMPON_FIN] = {};
+    std::memcpy(tampon, t + i, reste);
+    std::uint64_t bits = candidatsAVX2<IgnorerCasse>(tampon, k, premier, dernier);
+    bits &= (1ULL << (reste - k + 1)) - 1;
+    return verifierCandidats<IgnorerCasse>(bits, tampon, p, k);
+}
+#endif
+
+bool noyauDisponible(NoyauRecherche noyau) {
+    switch (noyau) {
+        case NOYAU_AUTO:
+        case NOYAU_SCALAIRE:
+            return true;
+        case NOYAU_SSE2:
+#ifdef __SSE2__
+            return true;
+#else
+            return false;
+#endif
+        case NOYAU_AVX2:
+#ifdef RECHERCHE_AVX2
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+NoyauRecherche noyauAutomatique() {
+    static const NoyauRecherche choisi = noyauDisponible(NOYAU_AVX2) ? NOYAU_AVX2
+                                       : noyauDisponible(NOYAU_SSE2) ? NOYAU_SSE2
+                                       : NOYAU_SCALAIRE;
+    return choisi;
+}
+
+const char* nomNoyau(NoyauRecherche noyau) {
+    switch (noyau) {
+        case NOYAU_AUTO: return "auto";
+        case NOYAU_SCALAIRE: return "scalaire";
+        case NOYAU_SSE2: return "sse2";
+        case NOYAU_AVX2: return "avx2";
+    }
+    return "?";
+}
+
+// La fonction de recherche d'une version, pour un motif avec ou sans casse
+template <bool IgnorerCasse>
+static bool (*fonctionNoyau(NoyauRecherche noyau))(std::string_view, std::string_view) {
+    switch (noyau) {
+#ifdef RECHERCHE_AVX2
+        case NOYAU_AVX2: return contientAVX2<IgnorerCasse>;
+#endif
+#ifdef __SSE2__
+        case NOYAU_SSE2: return contientSSE2<IgnorerCasse>;
+#endif
+        default: return contientScalaire<IgnorerCasse>;
+    }
+}
+
+MotifRecherche preparerMotif(std::string_view motif, bool ignorerCasse, NoyauRecherche noyau) {
+    if (noyau == NOYAU_AUTO) noyau = noyauAutomatique();
+    if (!noyauDisponible(noyau)) noyau = NOYAU_SCALAIRE;
+
+    MotifRecherche prepare;
+    prepare.motif = motif;
+    if (ignorerCasse) {
+        for (char& c : prepare.motif) c = plier(c);
+    }
+    prepare.contient = ignorerCasse ? fonctionNoyau<true>(noyau) : fonctionNoyau<false>(noyau);
+    return prepare;
+}
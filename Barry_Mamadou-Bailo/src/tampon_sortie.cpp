@@ -0,0 +1,62 @@
+/**
+ * @file tampon_sortie.cpp
+ * @brief Écriture par blocs et échappement HTML (voir tampon_sortie.hpp).
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ */
+
+#include "tampon_sortie.hpp"
+#include "fichier_atomique.hpp" // Pour la somme de contrôle
+
+// Envoie un morceau au flux (en passant par la somme de contrôle s'il y en a une)
+static void envoyer(TamponSortie& t, const char* donnees, std::size_t taille) {
+    if (t.somme != nullptr) ajouterSomme(*t.somme, donnees, taille);
+    t.sortie->write(donnees, static_cast<std::streamsize>(taille));
+}
+
+void ouvrirTamponSortie(TamponSortie& t, std::ostream& sortie) {
+    t.sortie = &sortie;
+    t.somme = nullptr;
+    t.tampon.clear();
+    t.tampon.reserve(TAILLE_TAMPON_SORTIE);
+}
+
+void viderTamponSortie(TamponSortie& t) {
+    if (!t.tampon.empty()) {
+        envoyer(t, t.tampon.data(), t.tampon.size());
+        t.tampon.clear(); // clear() garde la capacité : pas de nouvelle allocation
+    }
+    t.sortie->flush();
+}
+
+void ecrire(TamponSortie& t, std::string_view texte) {
+    if (t.tampon.size() + texte.size() > TAILLE_TAMPON_SORTIE) {
+        viderTamponSortie(t);
+        // Texte plus grand que le tampon entier : on l'écrit directement
+        if (texte.size() > TAILLE_TAMPON_SORTIE) {
+            envoyer(t, texte.data(), texte.size());
+            return;
+        }
+    }
+    t.tampon.append(texte.data(), texte.size());
+}
+
+void ecrireEchappeHTML(TamponSortie& t, std::string_view texte) {
+    // On copie par morceaux : tout ce qui précède un caractère spécial part en un seul append
+    std::size_t debut = 0;
+    for (std::size_t i = 0; i < texte.size(); i++) {
+        const char* remplacement = nullptr;
+        switch (texte[i]) {
+            case '&':  remplacement = "&amp;";  break;
+            case '<':  remplacement = "&lt;";   break;
+            case '>':  remplacement = "&gt;";   break;
+            case '"':  remplacement = "&quot;"; break;
+            case '\'': remplacement = "&#39;";  break;
+            default: continue;
+        }
+        ecrire(t, texte.substr(debut, i - debut));
+        ecrire(t, remplacement);
+        debut = i + 1;
+    }
+    ecrire(t, texte.substr(debut));
+}
@@ -15,6 +15,7 @@
 #include <ctime>    // Pour les fonctions de temps (si besoin)
 #include <string>
 #include "utils.hpp"
+#include "ecran.hpp"  // Effacement de l'écran (rendu par écran entier)
 #include <cctype>   // Pour std::tolower et isdigit
 
 // Fonction pour nettoyer l'écran.
@@ -24,10 +25,9 @@ void clearScreen() {
     #ifdef _WIN32
         system("cls"); // Commande Windows
     #else
-        // Sur Linux/Mac, on utilise les codes ANSI :
-        // \033[2J : Efface tout l'écran
-        // \033[1;1H : Replace le curseur en haut à gauche
-        std::cout << "\033[2J\033[1;1H";
+        // Sur Linux/Mac, on utilise les codes ANSI (\033[2J efface tout l'écran, \033[1;1H
+        // replace le curseur en haut à gauche), envoyés avec le reste de l'écran : voir ecran.hpp
+        effacerEcran();
     #endif
 }
 
@@ -39,8 +39,8 @@ void printColor(const std::string& text, int colorCode) {
 
 // Convertit une chaîne en minuscules pour faciliter les comparaisons
 // (ex: "Paris" devient "paris", utile pour la recherche insensible à la casse)
-std::string toLower(const std::string& str) {
-    std::string result = str;
+std::string toLower(std::string_view str) {
+    std::string result(str);
     // On parcourt chaque caractère par référence (&) pour le modifier directement
     for (char& c : result) {
         c = std::tolower(c);
@@ -48,52 +48,94 @@ std::string toLower(const std::string& str) {
     return result;
 }
 
-// Fonction robuste de validation de date (Format JJ/MM/AAAA)
-bool estDateValide(const std::string& date) {
-    // 1. Vérification de la longueur stricte (10 caractères)
-    if (date.length() != 10) return false;
-
-    // 2. Vérification que les séparateurs '/' sont au bon endroit
-    if (date[2] != '/' || date[5] != '/') return false;
-
-    // 3. Extraction et conversion des nombres
-    // J'utilise un bloc try-catch car std::stoi peut planter si ce n'est pas un nombre
-    try {
-        std::string jourStr = date.substr(0, 2);
-        std::string moisStr = date.substr(3, 2);
-        std::string anneeStr = date.substr(6, 4);
-
-        // Vérifie caractère par caractère que ce sont bien des chiffres
-        for (char c : jourStr) if (!isdigit(c)) return false;
-        for (char c : moisStr) if (!isdigit(c)) return false;
-        for (char c : anneeStr) if (!isdigit(c)) return false;
-
-        // Conversion en entiers pour les tests logiques
-        int jour = std::stoi(jourStr);
-        int mois = std::stoi(moisStr);
-        int annee = std::stoi(anneeStr);
-
-        // 4. Vérifications logiques
-        if (annee < 1000 || annee > 3000) return false; // On limite aux années réalistes
-        if (mois < 1 || mois > 12) return false;
-
-        // Tableau du nombre de jours par mois (index 0 ignoré pour correspondre aux mois 1-12)
-        int joursDansMois[] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
-        
-        // Gestion des années bissextiles pour Février :
-        // Une année est bissextile si divisible par 4 ET (pas par 100 OU par 400)
-        if ((annee % 4 == 0 && annee % 100 != 0) || (annee % 400 == 0)) {
-            joursDansMois[2] = 29;
+// Équivalent sans accent des lettres Latin-1 (U+00C0 à U+00FF), indexé par le 2e octet UTF-8 - 0x80.
+// Un 0 signifie "pas une lettre" (ex: ×, ÷) : le caractère devient un espace.
+static const char* const SANS_ACCENT[64] = {
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",   // À..Ï
+    "d", "n", "o", "o", "o", "o", "o", 0, "o", "u", "u", "u", "u", "y", "th", "ss",   // Ð..ß
+    "a", "a", "a", "a", "a", "a", "ae", "c", "e", "e", "e", "e", "i", "i", "i", "i",   // à..ï
+    "d", "n", "o", "o", "o", "o", "o", 0, "o", "u", "u", "u", "u", "y", "th", "y"     // ð..ÿ
+};
+
+std::string normaliserTexte(std::string_view texte) {
+    std::string resultat;
+    resultat.reserve(texte.size());
+
+    for (std::size_t i = 0; i < texte.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(texte[i]);
+
+        if (c < 0x80) {
+            // ASCII : lettres et chiffres en minuscules, le reste sépare les mots
+            resultat += std::isalnum(c) ? static_cast<char>(std::tolower(c)) : ' ';
+        }
+        else if (c == 0xC3 && i + 1 < texte.size()) {
+            // Lettres accentuées courantes (é, è, à, ç...) encodées en UTF-8 sur 2 octets
+            unsigned char suivant = static_cast<unsigned char>(texte[i + 1]);
+            const char* remplacement = (suivant >= 0x80 && suivant < 0xC0) ? SANS_ACCENT[suivant - 0x80] : 0;
+            resultat += remplacement ? remplacement : " ";
+            i++;
+        }
+        else if (c == 0xC5 && i + 1 < texte.size() && (texte[i + 1] == '\x92' || texte[i + 1] == '\x93')) {
+            resultat += "oe"; // Œ et œ (ex: "cœur")
+            i++;
         }
+        else {
+            // Autres alphabets : on garde les octets tels quels pour qu'ils restent cherchables
+            resultat += texte[i];
+        }
+    }
+    return resultat;
+}
 
-        // Vérification finale du jour par rapport au mois
-        if (jour < 1 || jour > joursDansMois[mois]) return false;
+// Fonction robuste de validation de date (Format JJ/MM/AAAA)
+bool estDateValide(std::string_view date) {
+    return dateCompacte(date) != 0;
+}
 
-        return true;
+// Décode une date JJ/MM/AAAA sans allocation ni exception.
+// Toutes les vérifications sont calculées puis combinées avec '&' (et non '&&') : le processeur
+// n'a presque aucun saut à prévoir, ce qui compte quand on décode des millions de dates à l'import.
+std::uint32_t dateCompacte(std::string_view date) {
+    // 1. Longueur stricte (10 caractères) : seul vrai test, avant de lire les caractères
+    if (date.size() != 10) return 0;
+    const unsigned char* c = reinterpret_cast<const unsigned char*>(date.data());
+
+    // 2. Chiffres : en non signé, un caractère qui n'est pas un chiffre donne une valeur > 9
+    const unsigned chiffres[8] = {c[0] - 48u, c[1] - 48u, c[3] - 48u, c[4] - 48u,
+                                  c[6] - 48u, c[7] - 48u, c[8] - 48u, c[9] - 48u};
+    bool valide = (c[2] == '/') & (c[5] == '/');
+    for (unsigned chiffre : chiffres) valide &= (chiffre <= 9);
+
+    unsigned jour = chiffres[0] * 10 + chiffres[1];
+    unsigned mois = chiffres[2] * 10 + chiffres[3];
+    unsigned annee = chiffres[4] * 1000 + chiffres[5] * 100 + chiffres[6] * 10 + chiffres[7];
+
+    // 3. Vérifications logiques (années réalistes, mois 1-12)
+    valide &= (annee >= 1000) & (annee <= 3000) & (mois >= 1) & (mois <= 12);
+
+    // Nombre de jours par mois (index 0 ignoré pour correspondre aux mois 1-12).
+    // Une année est bissextile si divisible par 4 ET (pas par 100 OU par 400) : février a alors 29 jours.
+    static const unsigned char joursDansMois[16] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0};
+    bool bissextile = (annee % 4 == 0) & ((annee % 100 != 0) | (annee % 400 == 0));
+    unsigned dernierJour = joursDansMois[mois & 15] + (bissextile & (mois == 2));
+
+    // 4. Vérification finale du jour par rapport au mois
+    valide &= (jour >= 1) & (jour <= dernierJour);
+
+    return valide ? annee * 10000 + mois * 100 + jour : 0;
+}
 
-    } catch (...) {
-        return false; // En cas d'erreur de conversion imprévue
+std::uint32_t borneDate(std::string_view saisie, bool fin) {
+    std::uint32_t date = dateCompacte(saisie);
+    if (date != 0 || saisie.empty() || saisie.size() > 4) return date;
+    // Une année seule (1 à 4 chiffres)
+    std::uint32_t annee = 0;
+    for (char c : saisie) {
+        if (c < '0' || c > '9') return 0;
+        annee = annee * 10 + static_cast<std::uint32_t>(c - '0');
     }
+    if (annee == 0) return 0;
+    return annee * 10000 + (fin ? 1231 : 101);
 }
 
 // Affiche l'en-tête commun à tous les menus
@@ -102,12 +144,12 @@ void afficherHeader(const std::string& titre, const AppConfig& config) {
     
     // 1. On affiche le Logo personnalisé (si présent)
     if (!config.logo.empty()) {
-        std::cout  << config.logo << RESET << std::endl;
+        std::cout  << config.logo << RESET << "\n";
     }
 
     // 2. On affiche le Titre de la section dans un bandeau Bleu
     // Les espaces servent à centrer/aérer le texte
-    std::cout << "  " << BG_BLUE << WHITE << BOLD << "      " << titre << "      " << RESET << "\n" << std::endl;
+    std::cout << "  " << BG_BLUE << WHITE << BOLD << "      " << titre << "      " << RESET << "\n\n";
 }
 
 // Surcharge de la fonction printColor pour utiliser directement nos constantes string (ex: RED)
@@ -0,0 +1,228 @@
+#!/bin/sh
+# ==============================================================================
+# TEST DU MODE LIGNE DE COMMANDE (./app import / search / stats / export-html)
+# ==============================================================================
+# Contrairement à test.exp (le menu), ces commandes n'attendent aucune saisie :
+# un simple script shell suffit. Pour chaque commande on vérifie le code de
+# sortie (0 = succès, 1 = erreur, 2 = mauvais arguments) et un morceau de la sortie.
+# Tout se passe dans un dossier temporaire : le library.db du projet n'est pas touché.
+
+RACINE=$(cd "$(dirname "$0")/.." && pwd)
+APP="$RACINE/app"
+CONVERTIR="$RACINE/build/convertir"
+
+DOSSIER=$(mktemp -d) || exit 1
+trap 'rm -rf "$DOSSIER"' EXIT
+cd "$DOSSIER" || exit 1
+
+REUSSIS=0
+RATES=0
+
+# Lance ./app avec les arguments donnés : la sortie (stdout + stderr) va dans $SORTIE,
+# le code de sortie dans $CODE
+lancer() {
+    SORTIE=$("$APP" "$@" 2>&1)
+    CODE=$?
+}
+
+# verifier "description" code_attendu "motif attendu dans la sortie"
+verifier() {
+    if [ "$CODE" -eq "$2" ] && printf '%s\n' "$SORTIE" | grep -q -- "$3"; then
+        REUSSIS=$((REUSSIS + 1))
+        printf '  \033[32mOK\033[0m    %s\n' "$1"
+    else
+        RATES=$((RATES + 1))
+        printf '  \033[31mÉCHEC\033[0m %s (code %s, attendu %s ; motif \"%s\")\n' "$1" "$CODE" "$2" "$3"
+        printf '%s\n' "$SORTIE" | sed 's/^/        | /'
+    fi
+}
+
+# constater "description" condition... (mêmes arguments que la commande test)
+constater() {
+    description=$1
+    shift
+    if [ "$@" ]; then
+        REUSSIS=$((REUSSIS + 1))
+        printf '  \033[32mOK\033[0m    %s\n' "$description"
+    else
+        RATES=$((RATES + 1))
+        printf '  \033[31mÉCHEC\033[0m %s\n' "$description"
+    fi
+}
+
+# --- Fichier CSV de départ : 15 livres, 3 langues, 2 genres ---
+echo "ISBN;Titre;Langue;Auteurs;Date;Genre;Description" > lot.csv
+i=1
+while [ $i -le 15 ]; do
+    case $((i % 3)) in
+        0) langue=FR ;;
+        1) langue=EN ;;
+        *) langue=ES ;;
+    esac
+    if [ $((i % 2)) -eq 0 ]; then genre=Roman; else genre=Essai; fi
+    echo "978-CMD-$i;Livre Commande $i;$langue;Auteur $i;01/01/$((2000 + i));$genre;Description $i" >> lot.csv
+    i=$((i + 1))
+done
+
+printf '\n\033[1;34m=== [COMMANDES] IMPORT, RECHERCHE, STATISTIQUES, EXPORT ===\033[0m\n'
+
+lancer import lot.csv
+verifier "import d'un CSV" 0 "15 livres ajoutés sur 15 lignes"
+
+lancer import lot.csv --json
+verifier "import --json (doublons ignorés)" 0 '"ajoutes":0,"lignes":15'
+
+lancer search --isbn 978-CMD-7 --json
+verifier "search --isbn --json" 0 '"nombre":1,'
+verifier "search --json renvoie le bon livre" 0 '"titre":"Livre Commande 7"'
+
+lancer search --language FR --json
+verifier "search --language --json" 0 '"nombre":5,'
+
+lancer search --title Commande --limit 3
+verifier "search --limit (en-tête CSV)" 0 "^ISBN;Titre;Langue"
+constater "search --limit 3 : 3 lignes" "$(printf '%s\n' "$SORTIE" | wc -l)" -eq 4
+
+lancer stats
+verifier "stats : nombre de livres" 0 "^livres;15$"
+verifier "stats : format texte" 0 "^format;texte$"
+verifier "stats : genres" 0 "^genre;Essai;8$"
+
+lancer stats --json
+verifier "stats --json" 0 '"livres":15'
+
+lancer export-html catalogue.html
+verifier "export-html vers un fichier" 0 "catalogue.html : 15 livres"
+constater "export-html : catalogue.html écrit" -s catalogue.html
+
+mkdir site
+lancer export-html site/ --per-page 4
+verifier "export-html vers un dossier" 0 "15 livres"
+constater "export-html : site/index.html écrit" -s site/index.html
+
+printf '\n\033[1;34m=== [COMMANDES] ERREURS ===\033[0m\n'
+
+lancer frobnicate
+verifier "commande inconnue (code 2)" 2 "commande inconnue"
+
+lancer search --bogus
+verifier "option inconnue (code 2)" 2 "option inconnue"
+
+lancer import
+verifier "import sans fichier (code 2)" 2 "import attend un fichier CSV"
+
+lancer search --limit abc --title x
+verifier "--limit non numérique (code 2)" 2 "Erreur"
+
+lancer import absent.csv
+verifier "import d'un CSV absent (code 1)" 1 "Erreur"
+
+lancer import lot.csv --db "$DOSSIER/absent/biblio.db"
+verifier "base impossible à écrire (code 1)" 1 "Erreur"
+constater "base impossible à écrire : rien de créé" ! -e "$DOSSIER/absent"
+
+lancer export-html "$DOSSIER/absent/catalogue.html"
+verifier "export-html impossible à écrire (code 1)" 1 "Erreur"
+
+printf '\n\033[1;34m=== [COMMANDES] JOURNAL ET COMPACTAGE INTERROMPU ===\033[0m\n'
+
+# Trois petits lots de 5 livres, chacun importé dans journal.db par une commande à part
+for lot in A B C; do
+    echo "ISBN;Titre;Langue;Auteurs;Date;Genre;Description" > lot$lot.csv
+    for i in 1 2 3 4 5; do
+        echo "978-$lot-$i;Livre $lot $i;FR;Auteur $lot;01/01/2001;Roman;Lot $lot" >> lot$lot.csv
+    done
+done
+
+lancer import lotA.csv --db journal.db
+verifier "journal : premier import (fichier principal)" 0 "5 livres au total"
+lancer import lotB.csv --db journal.db
+verifier "journal : deuxième import" 0 "10 livres au total"
+constater "journal : ajouts écrits dans journal.db.journal" -s journal.db.journal
+
+# Compactage interrompu : le journal a été mis de côté (.compactage) mais le fichier
+# principal n'a pas encore été réécrit. Les sauvegardes suivantes écrivent un nouveau journal.
+mv journal.db.journal journal.db.journal.compactage
+lancer import lotC.csv --db journal.db
+verifier "journal : import après compactage interrompu" 0 "15 livres au total"
+
+# Au chargement, le journal mis de côté est rejoué avant le nouveau : rien n'est perdu
+lancer stats --db journal.db
+verifier "journal : les trois lots sont relus" 0 "^livres;15$"
+lancer search --isbn 978-B-3 --db journal.db --json
+verifier "journal : livre du journal mis de côté" 0 '"nombre":1,'
+lancer search --isbn 978-C-5 --db journal.db --json
+verifier "journal : livre du nouveau journal" 0 '"nombre":1,'
+
+printf '\n\033[1;34m=== [COMMANDES] SOMME DE CONTRÔLE DU CATALOGUE ===\033[0m\n'
+
+# Le catalogue texte se termine par "#SOMME;<16 chiffres hexadécimaux>" : la somme de tout
+# ce qui précède. Une base modifiée ou tronquée doit être refusée (code 1), sans être réécrite.
+lancer import lotA.csv --db somme.db
+verifier "somme : base de départ" 0 "5 livres au total"
+constater "somme : pied de fichier présent" "$(tail -n 1 somme.db | cut -c1-7)" = "#SOMME;"
+lancer stats --db somme.db
+verifier "somme : base intacte acceptée" 0 "^livres;5$"
+
+# Un livre modifié sans mettre la somme à jour
+sed 's/Livre A 3/Livre A 8/' somme.db > modifiee.db
+lancer stats --db modifiee.db
+verifier "somme : livre modifié refusé (code 1)" 1 "corrompu"
+
+# La somme elle-même abîmée (premier chiffre remplacé)
+sed 's/^#SOMME;./#SOMME;Z/' somme.db > pied.db
+lancer stats --db pied.db
+verifier "somme : pied abîmé refusé (code 1)" 1 "corrompu"
+
+# Fichier coupé avant le pied (écriture interrompue)
+sed '/^#SOMME;/d' somme.db > tronquee.db
+lancer search --title Livre --db tronquee.db
+verifier "somme : pied absent refusé (code 1)" 1 "corrompu"
+
+# Un import dans une base refusée ne doit pas l'écraser
+cp modifiee.db modifiee.avant
+lancer import lotB.csv --db modifiee.db
+verifier "somme : import refusé (code 1)" 1 "corrompu"
+constater "somme : base refusée laissée intacte" "$(cksum < modifiee.db)" = "$(cksum < modifiee.avant)"
+
+printf '\n\033[1;34m=== [COMMANDES] CATALOGUE BINAIRE (ALLER-RETOUR) ===\033[0m\n'
+
+# Même catalogue en texte et en binaire (build/convertir) : l'application lit le binaire
+# directement dans le fichier (mmap) et doit donner exactement les mêmes réponses.
+lancer import lot.csv --db texte.db
+verifier "binaire : catalogue texte de départ" 0 "15 livres au total"
+SORTIE=$("$CONVERTIR" --vers-binaire texte.db binaire.db 2>&1)
+CODE=$?
+verifier "binaire : conversion texte -> binaire" 0 "15 livres écrits dans binaire.db (binaire)"
+
+lancer stats --db binaire.db
+verifier "binaire : format reconnu" 0 "^format;binaire$"
+constater "binaire : mêmes statistiques qu'en texte" \
+    "$("$APP" stats --db binaire.db | grep -v '^format;')" = "$("$APP" stats --db texte.db | grep -v '^format;')"
+constater "binaire : même recherche --json qu'en texte" \
+    "$("$APP" search --title Commande --json --db binaire.db)" = "$("$APP" search --title Commande --json --db texte.db)"
+constater "binaire : même recherche par langue qu'en texte" \
+    "$("$APP" search --language EN --db binaire.db)" = "$("$APP" search --language EN --db texte.db)"
+
+# Retour en texte : les livres sont identiques à ceux de départ
+SORTIE=$("$CONVERTIR" --vers-texte binaire.db retour.db 2>&1)
+CODE=$?
+verifier "binaire : conversion binaire -> texte" 0 "15 livres écrits dans retour.db (texte)"
+constater "binaire : aller-retour sans perte" \
+    "$("$APP" search --title Commande --db retour.db)" = "$("$APP" search --title Commande --db texte.db)"
+
+# Un import dans la base binaire s'ajoute à son journal ; la base reste binaire
+lancer import lotA.csv --db binaire.db
+verifier "binaire : import dans la base binaire" 0 "20 livres au total"
+lancer stats --db binaire.db
+verifier "binaire : relue avec son journal" 0 "^livres;20$"
+verifier "binaire : toujours au format binaire" 0 "^format;binaire$"
+
+# Fichier binaire tronqué : refusé comme un catalogue texte abîmé
+head -c 100 binaire.db > binaire-tronque.db
+lancer stats --db binaire-tronque.db
+verifier "binaire : fichier tronqué refusé (code 1)" 1 "corrompu"
+
+# --- Bilan ---
+printf '\n%s réussis, %s ratés\n' "$REUSSIS" "$RATES"
+[ "$RATES" -eq 0 ]
@@ -0,0 +1,89 @@
+/**
+ * @file comparer_mesures.cpp
+ * @brief Compare deux résultats de bench_suite (lignes JSON) et affiche l'accélération.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Usage :
+ *   ./build/comparer_mesures reference.json nouveau.json
+ *
+ * Pour chaque opération mesurée dans les deux fichiers (même nom, même nombre de livres),
+ * affiche le temps par opération de chacun et l'accélération (temps de référence / nouveau
+ * temps : 2.0 = deux fois plus rapide). Utilisé par "make release", "make lto" et "make pgo"
+ * pour comparer la version optimisée à la compilation par défaut.
+ */
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Une ligne de bench_suite : {"operation":"import","livres":100000,...,"ns_par_op":4100,...}
+struct Mesure {
+    std::string operation;
+    std::string livres;
+    double nsParOp = 0;
+};
+
+// Valeur du champ 'nom' dans une ligne JSON simple (sans guillemets autour des textes)
+static std::string champ(const std::string& ligne, const std::string& nom) {
+    std::string cle = "\"" + nom + "\":";
+    std::size_t debut = ligne.find(cle);
+    if (debut == std::string::npos) return "";
+    debut += cle.size();
+    if (debut < ligne.size() && ligne[debut] == '"') debut++;
+    std::size_t fin = ligne.find_first_of("\",}", debut);
+    return ligne.substr(debut, fin - debut);
+}
+
+// Lit les mesures d'un fichier, dans l'ordre. Retourne false si le fichier ne s'ouvre pas.
+static bool lireMesures(const std::string& chemin, std::vector<Mesure>& mesures) {
+    std::ifstream fichier(chemin);
+    if (!fichier) return false;
+    std::string ligne;
+    while (std::getline(fichier, ligne)) {
+        Mesure m{champ(ligne, "operation"), champ(ligne, "livres"), 0};
+        std::string ns = champ(ligne, "ns_par_op");
+        if (m.operation.empty() || ns.empty()) continue; // Ligne qui n'est pas une mesure
+        try {
+            m.nsParOp = std::stod(ns);
+        } catch (...) {
+            continue;
+        }
+        mesures.push_back(m);
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage : " << argv[0] << " <reference.json> <nouveau.json>" << std::endl;
+        return 2;
+    }
+
+    std::vector<Mesure> reference, nouveau;
+    for (int i = 1; i <= 2; i++) {
+        if (!lireMesures(argv[i], i == 1 ? reference : nouveau)) {
+            std::cerr << "Erreur : Impossible de lire " << argv[i] << std::endl;
+            return 1;
+        }
+    }
+
+    std::map<std::pair<std::string, std::string>, double> tempsReference;
+    for (const auto& m : reference) tempsReference[{m.operation, m.livres}] = m.nsParOp;
+
+    std::cout << std::left << std::setw(17) << "operation" << std::right << std::setw(10) << "livres"
+              << std::setw(16) << "reference ns/op" << std::setw(14) << "nouveau ns/op" << std::setw(13) << "acceleration" << "\n";
+    std::cout << std::fixed;
+    for (const auto& m : nouveau) {
+        auto trouve = tempsReference.find({m.operation, m.livres});
+        if (trouve == tempsReference.end() || m.nsParOp <= 0) continue;
+        std::cout << std::left << std::setw(17) << m.operation << std::right << std::setw(10) << m.livres
+                  << std::setprecision(1) << std::setw(16) << trouve->second << std::setw(14) << m.nsParOp
+                  << std::setprecision(2) << std::setw(12) << trouve->second / m.nsParOp << "x" << "\n";
+    }
+    return 0;
+}
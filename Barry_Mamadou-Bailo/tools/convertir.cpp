@@ -0,0 +1,44 @@
+/**
+ * @file convertir.cpp
+ * @brief Outil de conversion du catalogue entre le format texte et le format binaire.
+ * @author Barry Mamadou Bailo
+ * @version 1.0
+ *
+ * Usage :
+ *   ./build/convertir --vers-binaire library.db library.bin
+ *   ./build/convertir --vers-texte   library.bin library.db
+ *
+ * Le format du fichier source est détecté automatiquement : seule la destination compte.
+ */
+
+#include <iostream>
+#include <string>
+#include "library.hpp"
+#include "catalogue_bin.hpp"
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage : " << argv[0] << " --vers-binaire|--vers-texte <source> <destination>" << std::endl;
+        return 2;
+    }
+
+    std::string mode = argv[1];
+    if (mode != "--vers-binaire" && mode != "--vers-texte") {
+        std::cerr << "Mode inconnu : " << mode << std::endl;
+        return 2;
+    }
+
+    Library lib;
+    if (chargerBibliotheque(lib, argv[2]) != CHARGE_OK) {
+        std::cerr << "Erreur : Impossible de lire " << argv[2] << " (absent ou corrompu)" << std::endl;
+        return 1;
+    }
+
+    // On choisit le format de sortie, puis on réécrit le fichier complet (journal inclus)
+    lib.formatBinaire = (mode == "--vers-binaire");
+    if (!sauvegarderInstantane(lib, argv[3])) return 1;
+
+    std::cout << lib.books.size() << " livres écrits dans " << argv[3]
+              << (lib.formatBinaire ? " (binaire)" : " (texte)") << std::endl;
+    return 0;
+}